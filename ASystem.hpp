@@ -5,10 +5,13 @@
 
 #pragma once
 
+#include <span>
+
 #include <Kube/Core/Expected.hpp>
 #include <Kube/Core/Hash.hpp>
 #include <Kube/Flow/Graph.hpp>
 
+#include "EntityAllocator.hpp"
 #include "PipelineEvent.hpp"
 
 namespace kF::ECS
@@ -18,6 +21,13 @@ namespace kF::ECS
     /** @brief Pipeline index */
     using PipelineIndex = std::uint32_t;
 
+    /** @brief Declared access of a system to a component type */
+    struct alignas_eighth_cacheline ComponentAccess
+    {
+        ComponentTypeId typeId {};
+        bool readOnly {};
+    };
+
     namespace Internal
     {
         class ASystem;
@@ -62,6 +72,11 @@ public:
     /** @brief Virtual system tick function  */
     [[nodiscard]] virtual bool tick(void) noexcept override { return true; }
 
+    /** @brief Virtual declared component access list getter
+     *  @note Used by the executor to only sequence systems with conflicting accesses inside a
+     *  pipeline graph, an empty list conservatively conflicts with every other system */
+    [[nodiscard]] virtual std::span<const ComponentAccess> componentAccesses(void) const noexcept { return {}; }
+
 
     /** @brief Get parent executor reference */
     [[nodiscard]] inline Executor &parent(void) const noexcept { return *_parent; }
@@ -102,6 +117,27 @@ public:
     /** @brief Removes a range of entities */
     void removeRange(const EntityRange range) noexcept;
 
+
+    /** @brief Get the generation of an entity, bumped every time the entity is removed */
+    [[nodiscard]] inline EntityGeneration generation(const Entity entity) const noexcept
+        { return _entityAllocator.generation(entity); }
+
+    /** @brief Make a versioned handle out of an entity */
+    [[nodiscard]] inline EntityHandle handle(const Entity entity) const noexcept
+        { return _entityAllocator.makeHandle(entity); }
+
+    /** @brief Check if a versioned handle still references the entity it was made from
+     *  @note A single generation compare, no sparse set lookup involved */
+    [[nodiscard]] inline bool isAlive(const EntityHandle handle) const noexcept
+        { return _entityAllocator.isAlive(handle); }
+
+
+    /** @brief Allocate an uninitialized span of per tick scratch objects from the pipeline arena
+     *  @note The memory is recycled at the next pipeline tick and must not outlive this one */
+    template<typename Type>
+    [[nodiscard]] inline std::span<Type> frameAlloc(const std::size_t count) const noexcept
+        { return std::span<Type>(reinterpret_cast<Type *>(frameAllocImpl(count * sizeof(Type), alignof(Type))), count); }
+
 protected:
     /** @brief Get pipeline index from pipeline runtime name */
     [[nodiscard]] Core::Expected<PipelineIndex> getPipelineIndex(const Core::HashedName pipelineHash) const noexcept;
@@ -127,16 +163,37 @@ protected:
     void sendEventOpaqueRetryOnFailure(const PipelineIndex pipelineIndex, PipelineEvent &&callback) const noexcept;
 
 
+    /** @brief Send a batch of events using pipeline index, resolving the destination only once
+     *  @note Events are moved from the span into the destination queue */
+    template<bool RetryOnFailure = true>
+    inline void sendEventsOpaque(const PipelineIndex pipelineIndex, const std::span<PipelineEvent> events) const noexcept
+    {
+        if constexpr (RetryOnFailure)
+            sendEventsOpaqueRetryOnFailure(pipelineIndex, events);
+        else
+            sendEventsOpaqueExitOnFailure(pipelineIndex, events);
+    }
+
+    /** @brief Send a batch of events using pipeline index (exit on failure) */
+    void sendEventsOpaqueExitOnFailure(const PipelineIndex pipelineIndex, const std::span<PipelineEvent> events) const noexcept;
+
+    /** @brief Send a batch of events using pipeline index (retry on failure) */
+    void sendEventsOpaqueRetryOnFailure(const PipelineIndex pipelineIndex, const std::span<PipelineEvent> events) const noexcept;
+
+
+    /** @brief Hiden implementation of frameAlloc */
+    [[nodiscard]] void *frameAllocImpl(const std::size_t bytes, const std::size_t alignment) const noexcept;
+
+
 private:
-    // Cacheline 0
+    // Cacheline 0 -> 1
     // vtable pointer
     Executor *_parent {};
     PipelineIndex _executorPipelineIndex {};
     bool _isTimeBound {};
     std::int64_t _tickRate {};
     Flow::GraphPtr _graph {};
-    Entity _lastEntity {};
-    Core::Vector<EntityRange, ECSAllocator> _freeEntities {};
+    EntityAllocator _entityAllocator {};
 };
 static_assert_alignof_cacheline(kF::ECS::Internal::ASystem);
-static_assert_sizeof_cacheline(kF::ECS::Internal::ASystem);
\ No newline at end of file
+static_assert_fit_double_cacheline(kF::ECS::Internal::ASystem);
\ No newline at end of file
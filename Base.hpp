@@ -47,14 +47,72 @@ namespace kF::ECS
     constexpr Entity EntityBitCount = sizeof(Entity) * 8;
 
 
+    /** @brief Entity generation counter */
+    using EntityGeneration = std::uint32_t;
+
+    /** @brief Versioned entity handle, detects stale references to recycled entity identifiers */
+    struct alignas_eighth_cacheline EntityHandle
+    {
+        Entity entity { NullEntity };
+        EntityGeneration generation {};
+
+        /** @brief Comparison operators */
+        [[nodiscard]] constexpr bool operator==(const EntityHandle &other) const noexcept = default;
+        [[nodiscard]] constexpr bool operator!=(const EntityHandle &other) const noexcept = default;
+    };
+
+
     /** @brief Convert hertz into time rate */
     [[nodiscard]] constexpr std::int64_t HzToRate(const std::int64_t hertz) noexcept
         { return 1'000'000'000ll / hertz; }
 
+    /** @brief Opaque runtime identifier of a component type */
+    using ComponentTypeId = const void *;
+
+
+    /** @brief Memory footprint of a component table in bytes
+     *  @note Index sparse set pages are not included, Core::SparseSet does not expose them */
+    struct alignas_quarter_cacheline TableMemoryUsage
+    {
+        std::size_t usedBytes {};
+        std::size_t allocatedBytes {};
+
+        /** @brief Accumulate another usage report */
+        constexpr TableMemoryUsage &operator+=(const TableMemoryUsage &other) noexcept
+        {
+            usedBytes += other.usedBytes;
+            allocatedBytes += other.allocatedBytes;
+            return *this;
+        }
+    };
+
+
+    /** @brief Magic number identifying binary component table snapshots */
+    constexpr std::uint32_t TableSnapshotMagic = 0x4B454353u;
+
+    /** @brief Header of a binary component table snapshot */
+    struct alignas_eighth_cacheline TableSnapshotHeader
+    {
+        std::uint32_t magic {};
+        EntityIndex count {};
+    };
+
     namespace Internal
     {
         /** @brief Initializer of entity indexes */
         constexpr void EntityIndexInitializer(EntityIndex * const begin, EntityIndex * const end) noexcept
             { std::fill(begin, end, NullEntityIndex); }
+
+        /** @brief Unique tag whose address identifies a component type at runtime */
+        template<typename Type>
+        inline constexpr bool ComponentTypeTag {};
+
+        /** @brief Empty placeholder for zero-storage table modes */
+        struct NoComponentStorage {};
     }
+
+    /** @brief Get the unique runtime identifier of a component type */
+    template<typename Type>
+    [[nodiscard]] constexpr ComponentTypeId GetComponentTypeId(void) noexcept
+        { return &Internal::ComponentTypeTag<std::remove_cvref_t<Type>>; }
 }
\ No newline at end of file
@@ -0,0 +1,155 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of ComponentTable
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/ECS/ComponentTable.hpp>
+
+using namespace kF;
+
+namespace
+{
+    struct Position
+    {
+        float x {};
+        float y {};
+        float z {};
+        float w {};
+    };
+
+    using Table = ECS::ComponentTable<Position, 4096 / sizeof(ECS::Entity)>;
+
+    /** @brief Dense entity distribution: consecutive identifiers */
+    [[nodiscard]] constexpr ECS::Entity DenseEntity(const ECS::Entity index) noexcept { return index + 1u; }
+
+    /** @brief Sparse entity distribution: one entity per sparse set page region */
+    [[nodiscard]] constexpr ECS::Entity SparseEntity(const ECS::Entity index) noexcept { return index * 64u + 1u; }
+}
+
+static void ECS_ComponentTable_Add(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Table table;
+        state.ResumeTiming();
+        for (ECS::Entity index {}; index != count; ++index)
+            benchmark::DoNotOptimize(table.add(DenseEntity(index), Position { static_cast<float>(index), 0.0f, 0.0f, 0.0f }));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(ECS_ComponentTable_Add)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+
+static void ECS_ComponentTable_AddSparse(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Table table;
+        state.ResumeTiming();
+        for (ECS::Entity index {}; index != count; ++index)
+            benchmark::DoNotOptimize(table.add(SparseEntity(index), Position { static_cast<float>(index), 0.0f, 0.0f, 0.0f }));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(ECS_ComponentTable_AddSparse)->Arg(1'000)->Arg(100'000);
+
+static void ECS_ComponentTable_TryAddExisting(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    Table table;
+
+    for (ECS::Entity index {}; index != count; ++index)
+        table.add(DenseEntity(index), Position {});
+    for (auto _ : state) {
+        for (ECS::Entity index {}; index != count; ++index)
+            benchmark::DoNotOptimize(table.tryAdd(DenseEntity(index), Position { static_cast<float>(index), 0.0f, 0.0f, 0.0f }));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(ECS_ComponentTable_TryAddExisting)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+
+static void ECS_ComponentTable_Remove(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Table table;
+        for (ECS::Entity index {}; index != count; ++index)
+            table.add(DenseEntity(index), Position {});
+        state.ResumeTiming();
+        for (ECS::Entity index {}; index != count; ++index)
+            table.remove(DenseEntity(index));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(ECS_ComponentTable_Remove)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+
+static void ECS_ComponentTable_AddRange(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Table table;
+        state.ResumeTiming();
+        table.addRange(ECS::EntityRange { .begin = 1u, .end = count + 1u }, Position {});
+        benchmark::DoNotOptimize(table.count());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(ECS_ComponentTable_AddRange)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+
+static void ECS_ComponentTable_RemoveRange(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Table table;
+        table.addRange(ECS::EntityRange { .begin = 1u, .end = count + 1u }, Position {});
+        state.ResumeTiming();
+        table.removeRange(ECS::EntityRange { .begin = 1u, .end = count + 1u });
+        benchmark::DoNotOptimize(table.count());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(ECS_ComponentTable_RemoveRange)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+
+static void ECS_ComponentTable_Traverse(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    Table table;
+
+    for (ECS::Entity index {}; index != count; ++index)
+        table.add(DenseEntity(index), Position { static_cast<float>(index), 0.0f, 0.0f, 0.0f });
+    for (auto _ : state) {
+        float sum {};
+        table.traverse([&sum](Position &position) { sum += position.x; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(ECS_ComponentTable_Traverse)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+
+static void ECS_ComponentTable_RawIteration(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    Table table;
+
+    for (ECS::Entity index {}; index != count; ++index)
+        table.add(DenseEntity(index), Position { static_cast<float>(index), 0.0f, 0.0f, 0.0f });
+    for (auto _ : state) {
+        float sum {};
+        for (const auto &position : table)
+            sum += position.x;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(ECS_ComponentTable_RawIteration)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
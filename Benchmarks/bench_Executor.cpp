@@ -0,0 +1,122 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of Executor
+ */
+
+#include <atomic>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/ECS/Executor.hpp>
+
+using namespace kF;
+using namespace kF::Core::Literal;
+
+namespace
+{
+    using PipelineA = ECS::PipelineTag<"BenchA"_fixed>;
+    using PipelineB = ECS::PipelineTag<"BenchB"_fixed>;
+    using PipelineC = ECS::PipelineTag<"BenchC"_fixed>;
+    using PipelineD = ECS::PipelineTag<"BenchD"_fixed>;
+
+    /** @brief Trivial system ticking without scheduling work */
+    template<typename TargetPipeline>
+    class BenchSystem : public ECS::System<"Bench", TargetPipeline>
+    {
+    public:
+        [[nodiscard]] bool tick(void) noexcept override { return false; }
+    };
+
+    /** @brief System stopping its executor once a shared tick budget is exhausted */
+    template<typename TargetPipeline>
+    class CountingSystem : public ECS::System<"Counting", TargetPipeline>
+    {
+    public:
+        CountingSystem(std::atomic_size_t *remaining) : _remaining(remaining) {}
+
+        [[nodiscard]] bool tick(void) noexcept override
+        {
+            if (_remaining->fetch_sub(1u) == 1u)
+                this->parent().stop();
+            return false;
+        }
+
+    private:
+        std::atomic_size_t *_remaining {};
+    };
+
+    /** @brief High pipeline frequency so tick latency is not dominated by waits */
+    constexpr std::int64_t PipelineFrequency = 1'000'000;
+
+    /** @brief Number of pipeline ticks dispatched per measured run */
+    constexpr std::size_t TicksPerRun = 1'000;
+}
+
+static void ECS_Executor_Tick(benchmark::State &state)
+{
+    ECS::Executor executor;
+    std::atomic_size_t remaining { 0u };
+
+    // Register 'state.range(0)' pipelines; the first one counts dispatched ticks and stops the run
+    const auto pipelineCount = state.range(0);
+    executor.addPipeline<PipelineA>(PipelineFrequency);
+    executor.addSystem<CountingSystem<PipelineA>>(&remaining);
+    if (pipelineCount > 1) {
+        executor.addPipeline<PipelineB>(PipelineFrequency);
+        executor.addSystem<BenchSystem<PipelineB>>();
+    }
+    if (pipelineCount > 2) {
+        executor.addPipeline<PipelineC>(PipelineFrequency);
+        executor.addSystem<BenchSystem<PipelineC>>();
+        executor.addPipeline<PipelineD>(PipelineFrequency);
+        executor.addSystem<BenchSystem<PipelineD>>();
+    }
+
+    // Each measured run dispatches the whole tick budget through built pipeline graphs
+    for (auto _ : state) {
+        remaining.store(TicksPerRun);
+        executor.run();
+    }
+    state.SetItemsProcessed(state.iterations() * TicksPerRun);
+}
+BENCHMARK(ECS_Executor_Tick)->Arg(1)->Arg(2)->Arg(4);
+
+static void ECS_PipelineEvent_QueueRoundTrip(benchmark::State &state)
+{
+    Core::MPSCQueue<ECS::PipelineEvent, ECS::ECSAllocator> queue(4096u, false);
+
+    // Measure the push / pop / invoke round-trip of one pipeline event
+    std::size_t counter {};
+    for (auto _ : state) {
+        (void)queue.push<true>(ECS::PipelineEvent([&counter] { ++counter; }));
+        ECS::PipelineEvent event;
+        while (queue.pop(event))
+            event();
+        benchmark::DoNotOptimize(counter);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ECS_PipelineEvent_QueueRoundTrip);
+
+static void ECS_PipelineEvent_QueueContended(benchmark::State &state)
+{
+    // Shared across threads, initialization is synchronized by the magic static
+    static Core::MPSCQueue<ECS::PipelineEvent, ECS::ECSAllocator> Queue(4096u, false);
+    static std::atomic_size_t Counter {};
+
+    if (state.thread_index() == 0) {
+        // Single consumer pops and executes events
+        for (auto _ : state) {
+            ECS::PipelineEvent event;
+            while (Queue.pop(event))
+                event();
+            benchmark::DoNotOptimize(Counter.load());
+        }
+    } else {
+        // Producers push under contention, full queue pushes are dropped
+        for (auto _ : state)
+            (void)Queue.push<true>(ECS::PipelineEvent([] { ++Counter; }));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ECS_PipelineEvent_QueueContended)->Threads(2)->Threads(4)->Threads(8);
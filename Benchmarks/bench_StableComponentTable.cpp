@@ -0,0 +1,95 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of StableComponentTable
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/ECS/StableComponentTable.hpp>
+
+using namespace kF;
+
+namespace
+{
+    struct Widget
+    {
+        float x {};
+        float y {};
+        float width {};
+        float height {};
+    };
+
+    using Table = ECS::StableComponentTable<Widget, 4096 / sizeof(Widget), 4096 / sizeof(ECS::Entity)>;
+
+    constexpr ECS::Entity EntityCount = 100'000u;
+
+    /** @brief Fill a table then punch 'tombstonePercent' % of holes into it */
+    void FillWithTombstones(Table &table, const ECS::Entity count, const std::int64_t tombstonePercent) noexcept
+    {
+        table.addRange(ECS::EntityRange { .begin = 1u, .end = count + 1u }, Widget {});
+        if (!tombstonePercent)
+            return;
+        const auto stride = 100u / static_cast<ECS::Entity>(tombstonePercent);
+        for (ECS::Entity entity = 1u; entity < count + 1u; entity += stride)
+            table.remove(entity);
+    }
+}
+
+static void ECS_StableComponentTable_Add(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Table table;
+        state.ResumeTiming();
+        for (ECS::Entity index {}; index != count; ++index)
+            benchmark::DoNotOptimize(table.add(index + 1u, Widget { static_cast<float>(index), 0.0f, 0.0f, 0.0f }));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(ECS_StableComponentTable_Add)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+
+static void ECS_StableComponentTable_TraverseTombstones(benchmark::State &state)
+{
+    Table table;
+
+    FillWithTombstones(table, EntityCount, state.range(0));
+    for (auto _ : state) {
+        float sum {};
+        table.traverse([&sum](Widget &widget) { sum += widget.x; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * table.count());
+}
+BENCHMARK(ECS_StableComponentTable_TraverseTombstones)->Arg(0)->Arg(10)->Arg(30)->Arg(50);
+
+static void ECS_StableComponentTable_TraversePacked(benchmark::State &state)
+{
+    Table table;
+
+    // Same tombstone ratio as the previous benchmark, packed before traversal
+    FillWithTombstones(table, EntityCount, state.range(0));
+    table.pack();
+    for (auto _ : state) {
+        float sum {};
+        table.traverse([&sum](Widget &widget) { sum += widget.x; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * table.count());
+}
+BENCHMARK(ECS_StableComponentTable_TraversePacked)->Arg(10)->Arg(30)->Arg(50);
+
+static void ECS_StableComponentTable_Pack(benchmark::State &state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        Table table;
+        FillWithTombstones(table, EntityCount, state.range(0));
+        state.ResumeTiming();
+        table.pack();
+        benchmark::DoNotOptimize(table.count());
+    }
+    state.SetItemsProcessed(state.iterations() * EntityCount);
+}
+BENCHMARK(ECS_StableComponentTable_Pack)->Arg(10)->Arg(30)->Arg(50);
@@ -0,0 +1,109 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Command buffer
+ */
+
+#pragma once
+
+#include <Kube/Core/TupleUtils.hpp>
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    template<typename SystemType>
+    class CommandBuffer;
+
+    namespace Internal
+    {
+        /** @brief Recorded attach command */
+        template<typename ComponentType>
+        struct AttachCommand
+        {
+            Entity entity {};
+            ComponentType component {};
+        };
+
+        /** @brief Forward a components tuple into a tuple of command lists */
+        template<typename Tuple, template<typename> typename ListType>
+        struct ForwardCommandLists;
+        template<template<typename> typename ListType, typename ...Components>
+        struct ForwardCommandLists<std::tuple<Components...>, ListType>
+        {
+            using Type = std::tuple<ListType<Components>...>;
+        };
+    }
+}
+
+/** @brief Per worker buffers recording structural changes during a parallel tick
+ *  @note Workers record typed attach / detach / remove commands without synchronization, each into
+ *  their own cacheline padded buffer, then the owner system replays everything in bulk through
+ *  'apply' at a safe point of its tick. Commands are replayed grouped by kind (attaches, then
+ *  detaches, then removes), not in recording order, and removes are coalesced into entity ranges
+ *  @tparam SystemType System owning the component tables targeted by recorded commands */
+template<typename SystemType>
+class kF::ECS::CommandBuffer
+{
+public:
+    /** @brief Components of the target system */
+    using ComponentsTuple = typename SystemType::ComponentsTuple;
+
+    /** @brief List of recorded attaches of a component */
+    template<typename ComponentType>
+    using AttachList = Core::Vector<Internal::AttachCommand<ComponentType>, ECSAllocator>;
+
+    /** @brief List of recorded entities */
+    using EntityList = Core::Vector<Entity, ECSAllocator>;
+
+    /** @brief List of recorded detaches of a component */
+    template<typename>
+    using DetachList = EntityList;
+
+    /** @brief Per worker command storage */
+    struct alignas_double_cacheline WorkerCache
+    {
+        typename Internal::ForwardCommandLists<ComponentsTuple, AttachList>::Type attaches {};
+        typename Internal::ForwardCommandLists<ComponentsTuple, DetachList>::Type detaches {};
+        EntityList removes {};
+    };
+
+
+    /** @brief Destructor */
+    ~CommandBuffer(void) noexcept = default;
+
+    /** @brief Construct buffers for a fixed number of workers */
+    CommandBuffer(const std::size_t workerCount) noexcept;
+
+    /** @brief CommandBuffer is not copiable */
+    CommandBuffer(const CommandBuffer &other) noexcept = delete;
+    CommandBuffer &operator=(const CommandBuffer &other) noexcept = delete;
+
+
+    /** @brief Get the number of worker buffers */
+    [[nodiscard]] inline std::size_t workerCount(void) const noexcept { return _workerCaches.size(); }
+
+
+    /** @brief Record a component attach from a worker
+     *  @note If the entity already owns the component, the old value is updated at replay */
+    template<typename Component>
+    void attach(const std::size_t workerIndex, const Entity entity, Component &&component) noexcept;
+
+    /** @brief Record a component detach from a worker */
+    template<typename Component>
+    void detach(const std::size_t workerIndex, const Entity entity) noexcept;
+
+    /** @brief Record an entity removal from a worker */
+    void remove(const std::size_t workerIndex, const Entity entity) noexcept;
+
+
+    /** @brief Replay every recorded command onto the target system then clear all buffers
+     *  @note Must be called from a point where no worker is recording, typically the system tick */
+    void apply(SystemType &system) noexcept;
+
+private:
+    Core::Vector<WorkerCache, ECSAllocator> _workerCaches {};
+    EntityList _removeScratch {};
+};
+
+#include "CommandBuffer.ipp"
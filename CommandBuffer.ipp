@@ -0,0 +1,106 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Command buffer
+ */
+
+#include <Kube/Core/Abort.hpp>
+
+#include "CommandBuffer.hpp"
+
+template<typename SystemType>
+inline kF::ECS::CommandBuffer<SystemType>::CommandBuffer(const std::size_t workerCount) noexcept
+{
+    kFAssert(workerCount != 0,
+        "ECS::CommandBuffer: Worker count cannot be null");
+    for (std::size_t index {}; index != workerCount; ++index)
+        _workerCaches.push();
+}
+
+template<typename SystemType>
+template<typename Component>
+inline void kF::ECS::CommandBuffer<SystemType>::attach(const std::size_t workerIndex, const Entity entity, Component &&component) noexcept
+{
+    using FlatComponent = std::remove_cvref_t<Component>;
+
+    kFAssert(workerIndex < _workerCaches.size(),
+        "ECS::CommandBuffer::attach: Worker index '", workerIndex, "' out of range");
+    std::get<Core::TupleElementIndex<FlatComponent, ComponentsTuple>>(_workerCaches.at(workerIndex).attaches).push(
+        Internal::AttachCommand<FlatComponent> { .entity = entity, .component = std::forward<Component>(component) });
+}
+
+template<typename SystemType>
+template<typename Component>
+inline void kF::ECS::CommandBuffer<SystemType>::detach(const std::size_t workerIndex, const Entity entity) noexcept
+{
+    kFAssert(workerIndex < _workerCaches.size(),
+        "ECS::CommandBuffer::detach: Worker index '", workerIndex, "' out of range");
+    std::get<Core::TupleElementIndex<std::remove_cvref_t<Component>, ComponentsTuple>>(_workerCaches.at(workerIndex).detaches).push(entity);
+}
+
+template<typename SystemType>
+inline void kF::ECS::CommandBuffer<SystemType>::remove(const std::size_t workerIndex, const Entity entity) noexcept
+{
+    kFAssert(workerIndex < _workerCaches.size(),
+        "ECS::CommandBuffer::remove: Worker index '", workerIndex, "' out of range");
+    _workerCaches.at(workerIndex).removes.push(entity);
+}
+
+template<typename SystemType>
+inline void kF::ECS::CommandBuffer<SystemType>::apply(SystemType &system) noexcept
+{
+    constexpr auto ComponentCount = std::tuple_size_v<ComponentsTuple>;
+
+    // Replay attaches of every worker first, grouped by table
+    for (auto &workerCache : _workerCaches) {
+        const auto replayAttaches = [&system, &workerCache]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+            const auto replay = [&system]<std::size_t Index>(auto &attaches, const std::integral_constant<std::size_t, Index>) {
+                using FlatComponent = std::tuple_element_t<Index, ComponentsTuple>;
+                for (auto &command : attaches)
+                    system.template getTable<FlatComponent>().tryAdd(command.entity, std::move(command.component));
+                attaches.clear();
+            };
+            (replay(std::get<Indexes>(workerCache.attaches), std::integral_constant<std::size_t, Indexes> {}), ...);
+        };
+        replayAttaches(std::make_index_sequence<ComponentCount> {});
+    }
+
+    // Then replay detaches of every worker, grouped by table
+    for (auto &workerCache : _workerCaches) {
+        const auto replayDetaches = [&system, &workerCache]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+            const auto replay = [&system]<std::size_t Index>(auto &detaches, const std::integral_constant<std::size_t, Index>) {
+                using FlatComponent = std::tuple_element_t<Index, ComponentsTuple>;
+                for (const auto entity : detaches)
+                    system.template getTable<FlatComponent>().tryRemove(entity);
+                detaches.clear();
+            };
+            (replay(std::get<Indexes>(workerCache.detaches), std::integral_constant<std::size_t, Indexes> {}), ...);
+        };
+        replayDetaches(std::make_index_sequence<ComponentCount> {});
+    }
+
+    // Finally collect removes of every worker into a single scratch list
+    for (auto &workerCache : _workerCaches) {
+        for (const auto entity : workerCache.removes)
+            _removeScratch.push(entity);
+        workerCache.removes.clear();
+    }
+
+    // Replay removes as coalesced entity ranges through the system batch path
+    if (!_removeScratch.empty()) [[likely]] {
+        std::sort(_removeScratch.begin(), _removeScratch.end());
+        _removeScratch.erase(std::unique(_removeScratch.begin(), _removeScratch.end()), _removeScratch.end());
+        auto it = _removeScratch.begin();
+        const auto end = _removeScratch.end();
+        while (it != end) {
+            auto runEnd = it + 1;
+            while (runEnd != end && *runEnd == *(runEnd - 1) + 1u)
+                ++runEnd;
+            if (runEnd - it == 1)
+                system.remove(*it);
+            else
+                system.removeRange(EntityRange { .begin = *it, .end = *(runEnd - 1) + 1u });
+            it = runEnd;
+        }
+        _removeScratch.clear();
+    }
+}
@@ -0,0 +1,86 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Component group
+ */
+
+#pragma once
+
+#include <tuple>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    template<typename ...Tables>
+    class ComponentGroup;
+}
+
+/** @brief Owning group that keeps its member tables co-sorted for zero-probe joint iteration
+ *  @note Every unstable table is owned: grouped entities are swapped to the front of the table's
+ *  dense arrays so that group iteration becomes parallel linear array walks without index lookups.
+ *  Stable tables cannot be reordered and fall back to one index probe per entity during traversal.
+ *  @note The group must be notified through 'onAdd' after an entity gained all group components and
+ *  through 'onRemove' before it loses any of them; removing a grouped component without notifying
+ *  the group first is an undefined behavior */
+template<typename ...Tables>
+class kF::ECS::ComponentGroup
+{
+public:
+    /** @brief Number of tables in the group */
+    static constexpr std::size_t TableCount = sizeof...(Tables);
+
+    /** @brief Index of the first owned table, used as traversal anchor */
+    static constexpr std::size_t AnchorIndex = [] {
+        constexpr bool Stables[] { Tables::IsStable... };
+        for (std::size_t index {}; index != sizeof...(Tables); ++index) {
+            if (!Stables[index])
+                return index;
+        }
+        return sizeof...(Tables);
+    }();
+
+    static_assert(TableCount > 1, "ECS::ComponentGroup: A group requires at least two tables");
+    static_assert(AnchorIndex != TableCount, "ECS::ComponentGroup: A group requires at least one unstable table to own");
+
+
+    /** @brief Destructor */
+    ~ComponentGroup(void) noexcept = default;
+
+    /** @brief Tables constructor */
+    inline ComponentGroup(Tables &...tables) noexcept : _tables(&tables...) {}
+
+    /** @brief ComponentGroup is not copiable */
+    ComponentGroup(const ComponentGroup &other) noexcept = delete;
+    ComponentGroup &operator=(const ComponentGroup &other) noexcept = delete;
+
+
+    /** @brief Get the number of entities inside the group */
+    [[nodiscard]] inline EntityIndex count(void) const noexcept { return _count; }
+
+    /** @brief Check if an entity is inside the group */
+    [[nodiscard]] bool contains(const Entity entity) const noexcept;
+
+
+    /** @brief Notify the group that an entity may have gained all group components
+     *  @note Does nothing if the entity misses any component or is already grouped */
+    void onAdd(const Entity entity) noexcept;
+
+    /** @brief Notify the group that an entity is about to lose a group component
+     *  @note Does nothing if the entity is not grouped */
+    void onRemove(const Entity entity) noexcept;
+
+
+    /** @brief Traverse the group with a callback taking (Entity, Components &...) as arguments or only (Components &...)
+     *  @note If the callback returns a boolean, traversal is stopped when 'false' is returned */
+    template<typename Callback>
+    void traverse(Callback &&callback) noexcept;
+
+private:
+    /** @brief Get the anchor table reference */
+    [[nodiscard]] inline auto &anchor(void) const noexcept { return *std::get<AnchorIndex>(_tables); }
+
+    std::tuple<Tables *...> _tables {};
+    EntityIndex _count {};
+};
+
+#include "ComponentGroup.ipp"
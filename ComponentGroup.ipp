@@ -0,0 +1,87 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Component group
+ */
+
+#include "ComponentGroup.hpp"
+
+template<typename ...Tables>
+inline bool kF::ECS::ComponentGroup<Tables...>::contains(const Entity entity) const noexcept
+{
+    const auto anchorIndex = anchor().getUnstableIndex(entity);
+    return anchorIndex != NullEntityIndex && anchorIndex < _count;
+}
+
+template<typename ...Tables>
+inline void kF::ECS::ComponentGroup<Tables...>::onAdd(const Entity entity) noexcept
+{
+    // Ignore entities that miss any group component or are already grouped
+    if (!std::apply([entity](const auto ...tables) { return (tables->exists(entity) && ...); }, _tables)
+            || contains(entity)) [[unlikely]]
+        return;
+
+    // Swap the entity to the front of every owned table, stable tables cannot be reordered
+    std::apply([this, entity](const auto ...tables) {
+        const auto swapToFront = [this, entity]<typename Table>(Table * const table) {
+            if constexpr (!Table::IsStable)
+                table->swapIndexes(table->getUnstableIndex(entity), _count);
+        };
+        (swapToFront(tables), ...);
+    }, _tables);
+    ++_count;
+}
+
+template<typename ...Tables>
+inline void kF::ECS::ComponentGroup<Tables...>::onRemove(const Entity entity) noexcept
+{
+    if (!contains(entity)) [[unlikely]]
+        return;
+
+    // Swap the entity with the last grouped slot of every owned table
+    const auto lastIndex = _count - 1u;
+    std::apply([entity, lastIndex](const auto ...tables) {
+        const auto swapToBack = [entity, lastIndex]<typename Table>(Table * const table) {
+            if constexpr (!Table::IsStable)
+                table->swapIndexes(table->getUnstableIndex(entity), lastIndex);
+        };
+        (swapToBack(tables), ...);
+    }, _tables);
+    --_count;
+}
+
+template<typename ...Tables>
+template<typename Callback>
+inline void kF::ECS::ComponentGroup<Tables...>::traverse(Callback &&callback) noexcept
+{
+    const auto &entities = anchor().entities();
+
+    for (EntityIndex index {}; index != _count; ++index) {
+        const auto entity = entities.at(index);
+        // Owned tables are co-sorted, stable tables fall back to one index probe
+        const auto fetch = [index, entity]<typename Table>(Table * const table) -> typename Table::ValueType & {
+            if constexpr (!Table::IsStable)
+                return table->atIndex(index);
+            else
+                return table->get(entity);
+        };
+        const auto invoke = [entity, &callback, &fetch]<std::size_t ...Indexes>(auto &tables, const std::index_sequence<Indexes...>) -> bool {
+            if constexpr (std::is_invocable_v<Callback, Entity, typename Tables::ValueType &...>) {
+                if constexpr (std::is_same_v<std::invoke_result_t<Callback, Entity, typename Tables::ValueType &...>, bool>)
+                    return callback(entity, fetch(std::get<Indexes>(tables))...);
+                else {
+                    callback(entity, fetch(std::get<Indexes>(tables))...);
+                    return true;
+                }
+            } else {
+                if constexpr (std::is_same_v<std::invoke_result_t<Callback, typename Tables::ValueType &...>, bool>)
+                    return callback(fetch(std::get<Indexes>(tables))...);
+                else {
+                    callback(fetch(std::get<Indexes>(tables))...);
+                    return true;
+                }
+            }
+        };
+        if (!invoke(_tables, std::make_index_sequence<TableCount> {}))
+            break;
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Component snapshot
+ */
+
+#pragma once
+
+#include <atomic>
+#include <span>
+
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    template<typename ComponentType, kF::Core::StaticAllocatorRequirements Allocator>
+    class ComponentSnapshot;
+}
+
+/** @brief Published copy of a component table readable from other pipelines without locks
+ *  @note The owner pipeline calls 'publish' at its tick boundary; readers in any other pipeline
+ *  call 'read' and get the last published values with plain loads, guarded by a sequence counter
+ *  that retries the callback if a publish raced it. The read callback may therefore observe torn
+ *  data and be invoked again: it must not have side effects it cannot repeat
+ *  @note Storage is reserved once at construction and never reallocates, keeping readers safe */
+template<typename ComponentType, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+class alignas_double_cacheline kF::ECS::ComponentSnapshot
+{
+public:
+    static_assert(std::is_trivially_copyable_v<ComponentType>,
+        "ECS::ComponentSnapshot: Component must be trivially copyable");
+
+    /** @brief List of published entities */
+    using Entities = Core::Vector<Entity, Allocator, EntityIndex>;
+
+    /** @brief List of published components */
+    using Components = Core::Vector<ComponentType, Allocator, EntityIndex>;
+
+
+    /** @brief Destructor */
+    ~ComponentSnapshot(void) noexcept = default;
+
+    /** @brief Capacity constructor, 'capacity' is the maximum number of publishable components */
+    inline ComponentSnapshot(const EntityIndex capacity) noexcept
+        { _entities.reserve(capacity); _components.reserve(capacity); }
+
+    /** @brief ComponentSnapshot is not copiable */
+    ComponentSnapshot(const ComponentSnapshot &other) noexcept = delete;
+    ComponentSnapshot &operator=(const ComponentSnapshot &other) noexcept = delete;
+
+
+    /** @brief Publish the packed content of a table, must only be called from the owner pipeline
+     *  @note The table count must not exceed the snapshot capacity */
+    template<typename Table>
+        requires std::is_same_v<typename Table::ValueType, ComponentType>
+    void publish(const Table &table) noexcept;
+
+    /** @brief Read the last published values
+     *  @note The callback must take (std::span<const Entity>, std::span<const ComponentType>) and
+     *  may be invoked again if a publish raced the read */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, std::span<const Entity>, std::span<const ComponentType>>
+    void read(Callback &&callback) const noexcept;
+
+private:
+    std::atomic<std::uint32_t> _sequence { 0u };
+    Entities _entities {};
+    Components _components {};
+};
+
+#include "ComponentSnapshot.ipp"
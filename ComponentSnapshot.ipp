@@ -0,0 +1,56 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Component snapshot
+ */
+
+#include <thread>
+
+#include <Kube/Core/Abort.hpp>
+
+#include "ComponentSnapshot.hpp"
+
+template<typename ComponentType, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Table>
+    requires std::is_same_v<typename Table::ValueType, ComponentType>
+inline void kF::ECS::ComponentSnapshot<ComponentType, Allocator>::publish(const Table &table) noexcept
+{
+    kFEnsure(table.count() <= _entities.capacity(),
+        "ECS::ComponentSnapshot::publish: Table count '", table.count(), "' exceeds snapshot capacity '", _entities.capacity(), '\'');
+
+    // Odd sequence marks the publish in progress
+    const auto sequence = _sequence.fetch_add(1u, std::memory_order_acq_rel);
+
+    // Copy the packed table content, capacity is reserved so no reallocation can happen
+    _entities.clear();
+    _components.clear();
+    table.traverse([this](const Entity entity, const ComponentType &component) {
+        _entities.push(entity);
+        _components.push(component);
+    });
+
+    // Even sequence releases the new values
+    _sequence.store(sequence + 2u, std::memory_order_release);
+}
+
+template<typename ComponentType, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, std::span<const kF::ECS::Entity>, std::span<const ComponentType>>
+inline void kF::ECS::ComponentSnapshot<ComponentType, Allocator>::read(Callback &&callback) const noexcept
+{
+    while (true) {
+        // Wait out an in-progress publish
+        const auto begin = _sequence.load(std::memory_order_acquire);
+        if (begin & 1u) [[unlikely]] {
+            std::this_thread::yield();
+            continue;
+        }
+        callback(
+            std::span<const Entity>(_entities.data(), _entities.size()),
+            std::span<const ComponentType>(_components.data(), _components.size())
+        );
+        // Retry if a publish raced the callback
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_sequence.load(std::memory_order_relaxed) == begin) [[likely]]
+            break;
+    }
+}
@@ -5,23 +5,41 @@
 
 #pragma once
 
+#include <span>
+
 #include <Kube/Core/SparseSet.hpp>
 
 #include "Base.hpp"
 
+namespace kF::Flow
+{
+    class Graph;
+    class Scheduler;
+}
+
 namespace kF::ECS
 {
-    template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+    template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
     class ComponentTable;
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator>
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator = kF::Core::DefaultStaticAllocator, bool ChangeTracking = false>
 class alignas_cacheline kF::ECS::ComponentTable
 {
 public:
     /** @brief Is table stable ? */
     static constexpr bool IsStable = false;
 
+    /** @brief Is the component a zero-storage tag ?
+     *  @note Empty components only keep the index sparse set and entity list: add / remove / exists
+     *  are pure sparse set operations and component accessors hand out a shared static instance */
+    static constexpr bool IsTagComponent = std::is_empty_v<ComponentType>;
+
+    /** @brief Is component change tracking enabled ?
+     *  @note Tracked tables stamp a per-component version on insertion, update and mutable get,
+     *  allowing 'traverseChanged' to only visit components modified since its previous call */
+    static constexpr bool IsChangeTracked = ChangeTracking;
+
 
     /** @brief ComponentType of stored component */
     using ValueType = ComponentType;
@@ -35,6 +53,12 @@ public:
     /** @brief List of entities' components */
     using Components = Core::Vector<ComponentType, Allocator, EntityIndex>;
 
+    /** @brief Modification version of a component */
+    using ComponentVersion = std::uint32_t;
+
+    /** @brief List of entities' component versions */
+    using Versions = Core::Vector<ComponentVersion, Allocator, EntityIndex>;
+
     /** @brief Component iterator */
     using ComponentIterator = Components::Iterator;
 
@@ -50,6 +74,10 @@ public:
     static_assert(IndexSparseSet::IsSafeToClear, "ECS::ComponentTable: There are no reason why index sparse set could not be safely cleared");
     static_assert(EntityPageSize != 0, "ECS::ComponentTable: Entity page size cannot be null");
 
+    /** @brief Default number of components per parallel traversal task, sized so each chunk covers whole cachelines */
+    static constexpr EntityIndex DefaultParallelGrainSize =
+        static_cast<EntityIndex>((Core::CacheLineSize * 64u + sizeof(ComponentType) - 1u) / sizeof(ComponentType));
+
 
 
     /** @brief Get the number of components inside the table */
@@ -77,6 +105,13 @@ public:
     template<typename ...Args>
     void addRange(const EntityRange range, const Args &...args) noexcept;
 
+    /** @brief Add a range of components into the table, each initialized through a functor
+     *  @note Initializer must be invocable as void(EntityIndex, ComponentType &), the index is
+     *  relative to the range begin and the component is default constructed beforehand */
+    template<typename Initializer>
+        requires std::is_invocable_v<Initializer, EntityIndex, ComponentType &>
+    void addRangeCustom(const EntityRange range, Initializer &&initializer) noexcept;
+
 
     /** @brief Remove a component from the table
      *  @note The entity must be inside table else its an undefined behavior (use exists to check if an entity is registered) */
@@ -97,21 +132,53 @@ public:
     [[nodiscard]] ComponentType extract(const Entity entity) noexcept;
 
 
-    /** @brief Get an entity's component */
+    /** @brief Get an entity's component
+     *  @note The mutable overload stamps the component as modified when change tracking is enabled */
     [[nodiscard]] inline const ComponentType &get(const Entity entity) const noexcept
-        { return _components.at(_indexSet.at(entity)); }
+        { return atIndex(_indexSet.at(entity)); }
     [[nodiscard]] inline ComponentType &get(const Entity entity) noexcept
-        { return const_cast<ComponentType &>(std::as_const(*this).get(entity)); }
+    {
+        const auto entityIndex = _indexSet.at(entity);
+        stampIndex(entityIndex);
+        return atIndex(entityIndex);
+    }
+
+
+    /** @brief Try to get an entity's component, returns nullptr if the entity is not in the table
+     *  @note The mutable overload stamps the component as modified when change tracking is enabled */
+    [[nodiscard]] inline ComponentType *tryGet(const Entity entity) noexcept
+    {
+        const auto entityIndex = getUnstableIndex(entity);
+        if (entityIndex == NullEntityIndex) [[unlikely]]
+            return nullptr;
+        stampIndex(entityIndex);
+        return &atIndex(entityIndex);
+    }
+    [[nodiscard]] inline const ComponentType *tryGet(const Entity entity) const noexcept
+    {
+        const auto entityIndex = getUnstableIndex(entity);
+        return entityIndex != NullEntityIndex ? &atIndex(entityIndex) : nullptr;
+    }
 
 
     /** @brief Get the unstable index of an entity (NullEntityIndex if not found) */
     [[nodiscard]] EntityIndex getUnstableIndex(const Entity entity) const noexcept;
 
     /** @brief Get an entity's component using its unstable index */
-    [[nodiscard]] inline ComponentType &atIndex(const EntityIndex entityIndex) noexcept
-        { return _components.at(entityIndex); }
-    [[nodiscard]] inline const ComponentType &atIndex(const EntityIndex entityIndex) const noexcept
-        { return _components.at(entityIndex); }
+    [[nodiscard]] inline ComponentType &atIndex([[maybe_unused]] const EntityIndex entityIndex) noexcept
+    {
+        if constexpr (IsTagComponent)
+            return _SharedTag;
+        else
+            return _components.at(entityIndex);
+    }
+    [[nodiscard]] inline const ComponentType &atIndex([[maybe_unused]] const EntityIndex entityIndex) const noexcept
+    {
+        if constexpr (IsTagComponent)
+            return _SharedTag;
+        else
+            return _components.at(entityIndex);
+    }
 
 
     /** @brief Components begin / end iterators */
@@ -140,6 +207,17 @@ public:
     template<typename CompareFunctor>
     void sort(CompareFunctor &&compareFunc) noexcept;
 
+    /** @brief Restore the sort order of a nearly sorted table using an adaptive insertion sort
+     *  @note Costs O(n + inversions) instead of the O(n log n) of a full 'sort', intended for
+     *  tables kept ordered across ticks where only few entities moved
+     *  @note CompareFunctor must have the following signature: bool(Entity, Entity) */
+    template<typename CompareFunctor>
+    void ensureSorted(CompareFunctor &&compareFunc) noexcept;
+
+    /** @brief Swap two components using their unstable indexes, patching the index sparse set
+     *  @note Both indexes must be valid else its an undefined behavior */
+    void swapIndexes(const EntityIndex lhs, const EntityIndex rhs) noexcept;
+
 
     /** @brief Clear the table */
     void clear(void) noexcept;
@@ -148,6 +226,13 @@ public:
     void release(void) noexcept;
 
 
+    /** @brief Release unused capacity of the dense arrays, keeping the table content intact */
+    void shrinkToFit(void) noexcept;
+
+    /** @brief Get the memory footprint of the table */
+    [[nodiscard]] TableMemoryUsage memoryUsage(void) const noexcept;
+
+
     /** @brief Traverse table with a callback taking (Entity, Component &) as arguments or only (Component &)
      *  @note If the callback returns a boolean, traversal is stopped when 'false' is returned */
     template<typename Callback>
@@ -166,6 +251,70 @@ public:
         { const_cast<ComponentTable &>(*this).traverse(std::forward<Callback>(callback)); }
 
 
+    /** @brief Traverse table in parallel by partitioning it into tasks of 'grainSize' components ran on 'scheduler'
+     *  @note The callback has the same signatures as 'traverse' and must be thread safe
+     *  @note If the callback returns a boolean, 'false' only stops the traversal of its own chunk
+     *  @note This function blocks until every task completed: it must not be called from a task
+     *  running on the same scheduler (e.g. a system tick), the blocking wait would starve the
+     *  workers supposed to execute the chunks, use 'recordTraverseParallel' there instead */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, ComponentType &>
+            || std::is_invocable_v<Callback, kF::ECS::Entity>
+            || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
+    void traverseParallel(Flow::Scheduler &scheduler, Callback &&callback, const EntityIndex grainSize = DefaultParallelGrainSize) noexcept;
+
+    /** @brief Record 'taskCount' parallel traversal tasks into 'graph', safe to use from system ticks
+     *  @note Each task computes its slice of the table when the graph executes, so the recorded
+     *  graph stays valid across table mutations and reruns; the callback is copied into every task
+     *  @note The callback has the same signatures as 'traverse' and must be thread safe
+     *  @note If the callback returns a boolean, 'false' only stops the traversal of its own slice */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, ComponentType &>
+            || std::is_invocable_v<Callback, kF::ECS::Entity>
+            || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
+    void recordTraverseParallel(Flow::Graph &graph, const Callback &callback, const EntityIndex taskCount) noexcept;
+
+
+    /** @brief Iterate over contiguous memory chunks of the table
+     *  @note The callback must take (std::span<const Entity>, std::span<ComponentType>) as arguments
+     *  @note Both spans always reference the same entities, making the chunks suitable for vectorized kernels */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, std::span<const Entity>, std::span<ComponentType>>
+    void forEachChunk(Callback &&callback) noexcept;
+
+    /** @brief Iterate over contiguous memory chunks of the table (const version) */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, std::span<const Entity>, std::span<const ComponentType>>
+    void forEachChunk(Callback &&callback) const noexcept;
+
+
+    /** @brief Traverse components modified since the previous 'traverseChanged' call
+     *  @note Only compiled when change tracking is enabled, see TrackedComponent
+     *  @note The callback has the same signatures as 'traverse'
+     *  @note If the callback returns a boolean, traversal is stopped when 'false' is returned but
+     *  the whole table is still marked as visited */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, ComponentType &>
+            || std::is_invocable_v<Callback, kF::ECS::Entity>
+            || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
+    void traverseChanged(Callback &&callback) noexcept;
+
+
+    /** @brief Serialize the table into a binary snapshot, emitting the dense arrays in bulk
+     *  @note Only available for trivially copyable components
+     *  @note Writer must be invocable as void(const void *data, std::size_t bytes) */
+    template<typename Writer>
+        requires std::is_invocable_v<Writer, const void *, std::size_t>
+    void serialize(Writer &&writer) const noexcept;
+
+    /** @brief Reconstruct the table from a binary snapshot, clearing its previous content
+     *  @note Only available for trivially copyable components
+     *  @note Reader must be invocable as void(void *data, std::size_t bytes) */
+    template<typename Reader>
+        requires std::is_invocable_v<Reader, void *, std::size_t>
+    void deserialize(Reader &&reader) noexcept;
+
+
     /** @brief Find an element by comparison */
     template<typename Comparable>
         requires requires(const ComponentType &lhs, const Comparable &rhs) { lhs == rhs; }
@@ -251,6 +400,15 @@ private:
     [[nodiscard]] EntityIndex findIndex(const Entity entity) const noexcept;
 
 
+    /** @brief Hiden implementation of traverse function over index range [from, to[ */
+    template<typename Callback>
+    void traverseRange(const EntityIndex from, const EntityIndex to, Callback &&callback) noexcept;
+
+
+    /** @brief Reorder components & sparse set after the entity list got sorted */
+    void applySortPatch(void) noexcept;
+
+
     /** @brief Hiden implementation of add function */
     template<typename ...Args>
     ComponentType &addImpl(const Entity entity, Args &&...args) noexcept;
@@ -260,9 +418,31 @@ private:
     void removeImpl(const Entity entity, const EntityIndex entityIndex) noexcept;
 
 
+    /** @brief Shared instance handed out by tag component accessors */
+    static inline ComponentType _SharedTag {};
+
+
+    /** @brief Change tracking state, only stored when enabled */
+    struct VersionState
+    {
+        Versions versions {};
+        ComponentVersion current { 1u };
+        ComponentVersion traversed {};
+    };
+
+
+    /** @brief Stamp a component as modified, no-op when change tracking is disabled */
+    inline void stampIndex([[maybe_unused]] const EntityIndex entityIndex) noexcept
+    {
+        if constexpr (ChangeTracking)
+            _versionState.versions.at(entityIndex) = _versionState.current;
+    }
+
+
     IndexSparseSet _indexSet {};
     Entities _entities {};
-    Components _components {};
+    [[no_unique_address]] std::conditional_t<IsTagComponent, Internal::NoComponentStorage, Components> _components {};
+    [[no_unique_address]] std::conditional_t<ChangeTracking, VersionState, Internal::NoComponentStorage> _versionState {};
 };
 
 #include "ComponentTable.ipp"
@@ -4,12 +4,14 @@
  */
 
 #include <Kube/Core/SmallVector.hpp>
+#include <Kube/Flow/Graph.hpp>
+#include <Kube/Flow/Scheduler.hpp>
 
 #include "ComponentTable.hpp"
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
 template<typename ...Args>
-inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::add(const Entity entity, Args &&...args) noexcept
+inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::add(const Entity entity, Args &&...args) noexcept
 {
     kFAssert(!exists(entity),
         "ECS::ComponentTable::add: Entity '", entity, "' already exists");
@@ -17,8 +19,8 @@ inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, All
     return addImpl(entity, std::forward<Args>(args)...);
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
-inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::tryAdd(const Entity entity, ComponentType &&component) noexcept
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::tryAdd(const Entity entity, ComponentType &&component) noexcept
 {
     if (auto componentIndex = findIndex(entity); componentIndex != NullEntityIndex) [[likely]] {
         return get(entity) = std::move(component);
@@ -27,12 +29,13 @@ inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, All
     }
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
 template<typename Functor>
-inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::tryAdd(const Entity entity, Functor &&functor) noexcept
+inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::tryAdd(const Entity entity, Functor &&functor) noexcept
 {
     ComponentType *ptr;
     if (const auto componentIndex = findIndex(entity); componentIndex != NullEntityIndex) [[likely]] {
+        stampIndex(componentIndex);
         ptr = &atIndex(componentIndex);
     } else {
         ptr = &addImpl(entity);
@@ -41,9 +44,9 @@ inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, All
     return *ptr;
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
 template<typename ...Args>
-inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::addRange(const EntityRange range, const Args &...args) noexcept
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::addRange(const EntityRange range, const Args &...args) noexcept
 {
     const auto lastIndex = _entities.size();
     const auto count = range.end - range.begin;
@@ -67,34 +70,97 @@ inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::a
         _indexSet.add(it, i);
     }
 
+    // Insert versions
+    if constexpr (ChangeTracking) {
+        _versionState.versions.insertCustom(_versionState.versions.end(), count,
+            [current = _versionState.current](const auto count, const auto data) {
+                for (EntityIndex index {}; index != count; ++index)
+                    data[index] = current;
+            });
+    }
+
     // Insert components
-    _components.insertCustom(_components.end(), count, [&args...](const auto count, const auto data) {
-        for (EntityIndex index {}; index != count; ++index) {
-            new (data + index) ComponentType(args...);
+    if constexpr (!IsTagComponent) {
+        _components.insertCustom(_components.end(), count, [&args...](const auto count, const auto data) {
+            for (EntityIndex index {}; index != count; ++index) {
+                new (data + index) ComponentType(args...);
+            }
+        });
+    }
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+template<typename Initializer>
+    requires std::is_invocable_v<Initializer, kF::ECS::EntityIndex, ComponentType &>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::addRangeCustom(const EntityRange range, Initializer &&initializer) noexcept
+{
+    const auto lastIndex = _entities.size();
+    const auto count = range.end - range.begin;
+
+    if constexpr (KUBE_DEBUG_BUILD) {
+        // Ensure no entity exists in range
+        for (const auto entity : _entities) {
+            kFEnsure(entity < range.begin || entity >= range.end,
+                "ECS::ComponentTable::addRangeCustom: Entity '", entity, "' from entity range [", range.begin, ", ", range.end, "[ already exists");
         }
+    }
+
+    // Insert entities
+    _entities.insertCustom(_entities.end(), count, [range](const auto count, const auto out) {
+        for (Entity i = 0; i != count; ++i)
+            out[i] = range.begin + i;
     });
+
+    // Insert indexes
+    for (Entity i = lastIndex, it = range.begin; it != range.end; ++i, ++it) {
+        _indexSet.add(it, i);
+    }
+
+    // Insert versions
+    if constexpr (ChangeTracking) {
+        _versionState.versions.insertCustom(_versionState.versions.end(), count,
+            [current = _versionState.current](const auto count, const auto data) {
+                for (EntityIndex index {}; index != count; ++index)
+                    data[index] = current;
+            });
+    }
+
+    // Insert components, filled in place by the initializer
+    if constexpr (!IsTagComponent) {
+        _components.insertCustom(_components.end(), count, [&initializer](const auto count, const auto data) {
+            for (EntityIndex index {}; index != count; ++index) {
+                new (data + index) ComponentType();
+                initializer(index, data[index]);
+            }
+        });
+    }
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
 template<typename ...Args>
-inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::addImpl(const Entity entity, Args &&...args) noexcept
+inline ComponentType &kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::addImpl(const Entity entity, [[maybe_unused]] Args &&...args) noexcept
 {
     const auto componentIndex = _entities.size();
     _indexSet.add(entity, componentIndex);
     _entities.push(entity);
-    return _components.push(std::forward<Args>(args)...);
+    if constexpr (ChangeTracking)
+        _versionState.versions.push(_versionState.current);
+    if constexpr (IsTagComponent)
+        return _SharedTag;
+    else
+        return _components.push(std::forward<Args>(args)...);
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
-inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::remove(const Entity entity) noexcept
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::remove(const Entity entity) noexcept
 {
     kFAssert(exists(entity),
         "ECS::ComponentTable::remove: Entity '", entity, "' doesn't exists");
     removeImpl(entity, _indexSet.extract(entity));
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
-inline bool kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::tryRemove(const Entity entity) noexcept
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline bool kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::tryRemove(const Entity entity) noexcept
 {
     if (const auto entityIndex = findIndex(entity); entityIndex != NullEntityIndex) [[likely]] {
         removeImpl(entity, entityIndex);
@@ -103,8 +169,8 @@ inline bool kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::t
         return false;
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
-inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::removeRange(const EntityRange range) noexcept
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::removeRange(const EntityRange range) noexcept
 {
     const auto removeBack = [this](const auto range, auto &last) {
         while (last) {
@@ -126,49 +192,80 @@ inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::r
         --last;
         target = _entities.at(last);
         atIndex(index) = std::move(atIndex(last));
+        if constexpr (ChangeTracking)
+            _versionState.versions.at(index) = _versionState.versions.at(last);
         _indexSet.remove(toRemove);
         _indexSet.at(target) = index;
         removeBack(range, last);
     }
+    if constexpr (!IsTagComponent)
+        _components.erase(_components.begin() + last, _components.end());
+    if constexpr (ChangeTracking)
+        _versionState.versions.erase(_versionState.versions.begin() + last, _versionState.versions.end());
     _entities.erase(_entities.begin() + last, _entities.end());
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
-inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::removeImpl(const Entity entity, const EntityIndex entityIndex) noexcept
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::removeImpl(const Entity entity, const EntityIndex entityIndex) noexcept
 {
-    if (_components.size() != entityIndex + 1) [[likely]] {
+    if (_entities.size() != entityIndex + 1) [[likely]] {
         const auto lastEntity = _entities.back();
         _indexSet.at(lastEntity) = entityIndex;
         _entities.at(entityIndex) = lastEntity;
-        _components.at(entityIndex) = std::move(_components.back());
+        if constexpr (!IsTagComponent)
+            _components.at(entityIndex) = std::move(_components.back());
+        if constexpr (ChangeTracking)
+            _versionState.versions.at(entityIndex) = _versionState.versions.back();
     }
     _indexSet.remove(entity);
     _entities.pop();
-    _components.pop();
+    if constexpr (!IsTagComponent)
+        _components.pop();
+    if constexpr (ChangeTracking)
+        _versionState.versions.pop();
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
-inline ComponentType kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::extract(const Entity entity) noexcept
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline ComponentType kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::extract(const Entity entity) noexcept
 {
     kFAssert(exists(entity),
         "ECS::ComponentTable::remove: Entity '", entity, "' doesn't exists");
 
     const auto componentIndex = _indexSet.extract(entity);
-    ComponentType value(std::move(_components.at(componentIndex)));
 
-    if (_components.size() != componentIndex + 1) [[likely]] {
-        const auto lastEntity = _entities.back();
-        _indexSet.at(lastEntity) = componentIndex;
-        _entities.at(componentIndex) = lastEntity;
-        _components.at(componentIndex) = std::move(_components.back());
+    if constexpr (IsTagComponent) {
+        if (_entities.size() != componentIndex + 1) [[likely]] {
+            const auto lastEntity = _entities.back();
+            _indexSet.at(lastEntity) = componentIndex;
+            _entities.at(componentIndex) = lastEntity;
+            if constexpr (ChangeTracking)
+                _versionState.versions.at(componentIndex) = _versionState.versions.back();
+        }
+        _entities.pop();
+        if constexpr (ChangeTracking)
+            _versionState.versions.pop();
+        return ComponentType {};
+    } else {
+        ComponentType value(std::move(_components.at(componentIndex)));
+
+        if (_components.size() != componentIndex + 1) [[likely]] {
+            const auto lastEntity = _entities.back();
+            _indexSet.at(lastEntity) = componentIndex;
+            _entities.at(componentIndex) = lastEntity;
+            _components.at(componentIndex) = std::move(_components.back());
+            if constexpr (ChangeTracking)
+                _versionState.versions.at(componentIndex) = _versionState.versions.back();
+        }
+        _entities.pop();
+        _components.pop();
+        if constexpr (ChangeTracking)
+            _versionState.versions.pop();
+        return value;
     }
-    _entities.pop();
-    _components.pop();
-    return value;
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
-inline kF::ECS::EntityIndex kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::getUnstableIndex(const Entity entity) const noexcept
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline kF::ECS::EntityIndex kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::getUnstableIndex(const Entity entity) const noexcept
 {
     if (_indexSet.pageExists(entity)) [[likely]]
         return _indexSet.at(entity);
@@ -176,24 +273,79 @@ inline kF::ECS::EntityIndex kF::ECS::ComponentTable<ComponentType, EntityPageSiz
         return NullEntityIndex;
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
-inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::clear(void) noexcept
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::clear(void) noexcept
 {
     _indexSet.clearUnsafe();
     _entities.clear();
-    _components.clear();
+    if constexpr (!IsTagComponent)
+        _components.clear();
+    if constexpr (ChangeTracking) {
+        _versionState.versions.clear();
+        _versionState.current = 1u;
+        _versionState.traversed = 0u;
+    }
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
-inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::release(void) noexcept
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::release(void) noexcept
 {
     _indexSet.releaseUnsafe();
     _entities.release();
-    _components.release();
+    if constexpr (!IsTagComponent)
+        _components.release();
+    if constexpr (ChangeTracking) {
+        _versionState.versions.release();
+        _versionState.current = 1u;
+        _versionState.traversed = 0u;
+    }
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::shrinkToFit(void) noexcept
+{
+    // Rebuild a vector into a tightly sized storage
+    const auto shrink = []<typename VectorType>(VectorType &vector) {
+        if (vector.capacity() == vector.size()) [[unlikely]]
+            return;
+        VectorType shrunk;
+        shrunk.reserve(vector.size());
+        shrunk.insertCustom(shrunk.end(), vector.size(), [&vector](const auto count, const auto data) {
+            using Value = std::remove_pointer_t<std::remove_cvref_t<decltype(data)>>;
+            for (auto index = decltype(count) {}; index != count; ++index)
+                new (data + index) Value(std::move(vector.at(index)));
+        });
+        vector = std::move(shrunk);
+    };
+
+    shrink(_entities);
+    if constexpr (!IsTagComponent)
+        shrink(_components);
+    if constexpr (ChangeTracking)
+        shrink(_versionState.versions);
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline kF::ECS::TableMemoryUsage kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::memoryUsage(void) const noexcept
+{
+    TableMemoryUsage usage {
+        .usedBytes = _entities.size() * sizeof(Entity),
+        .allocatedBytes = _entities.capacity() * sizeof(Entity)
+    };
+
+    if constexpr (!IsTagComponent) {
+        usage.usedBytes += _components.size() * sizeof(ComponentType);
+        usage.allocatedBytes += _components.capacity() * sizeof(ComponentType);
+    }
+    if constexpr (ChangeTracking) {
+        usage.usedBytes += _versionState.versions.size() * sizeof(ComponentVersion);
+        usage.allocatedBytes += _versionState.versions.capacity() * sizeof(ComponentVersion);
+    }
+    return usage;
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
-inline kF::ECS::EntityIndex kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::findIndex(const Entity entity) const noexcept
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline kF::ECS::EntityIndex kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::findIndex(const Entity entity) const noexcept
 {
     const auto it = _entities.find(entity);
     if (it != _entities.end()) [[likely]]
@@ -202,13 +354,37 @@ inline kF::ECS::EntityIndex kF::ECS::ComponentTable<ComponentType, EntityPageSiz
         return NullEntityIndex;
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
 template<typename CompareFunctor>
-inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::sort(CompareFunctor &&compareFunc) noexcept
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::sort(CompareFunctor &&compareFunc) noexcept
 {
     // Sort entities
     std::sort(_entities.begin(), _entities.end(), std::forward<CompareFunctor>(compareFunc));
 
+    applySortPatch();
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+template<typename CompareFunctor>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::ensureSorted(CompareFunctor &&compareFunc) noexcept
+{
+    // Adaptive insertion sort of the entity list, linear when the table is already sorted
+    for (EntityIndex index = 1u, count = _entities.size(); index < count; ++index) {
+        const auto entity = _entities.at(index);
+        auto hole = index;
+        while (hole && compareFunc(entity, _entities.at(hole - 1u))) {
+            _entities.at(hole) = _entities.at(hole - 1u);
+            --hole;
+        }
+        _entities.at(hole) = entity;
+    }
+
+    applySortPatch();
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::applySortPatch(void) noexcept
+{
     // Apply sort patch to components & sparse set
     for (EntityIndex from {}, to = _entities.size(); from != to; ++from) {
         auto current = from;
@@ -217,34 +393,227 @@ inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::s
             const auto index = _indexSet.at(_entities.at(next));
             const auto entity = _entities.at(current);
             std::swap(atIndex(next), atIndex(index));
+            if constexpr (ChangeTracking)
+                std::swap(_versionState.versions.at(next), _versionState.versions.at(index));
             _indexSet.at(entity) = current;
             current = std::exchange(next, index);
         }
     }
 }
 
-template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::swapIndexes(const EntityIndex lhs, const EntityIndex rhs) noexcept
+{
+    if (lhs == rhs) [[unlikely]]
+        return;
+    auto &lhsEntity = _entities.at(lhs);
+    auto &rhsEntity = _entities.at(rhs);
+    std::swap(_indexSet.at(lhsEntity), _indexSet.at(rhsEntity));
+    std::swap(lhsEntity, rhsEntity);
+    if constexpr (!IsTagComponent)
+        std::swap(_components.at(lhs), _components.at(rhs));
+    if constexpr (ChangeTracking)
+        std::swap(_versionState.versions.at(lhs), _versionState.versions.at(rhs));
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
 template<typename Callback>
     requires std::is_invocable_v<Callback, ComponentType &>
         || std::is_invocable_v<Callback, kF::ECS::Entity>
         || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
-inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator>::traverse(Callback &&callback) noexcept
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::traverse(Callback &&callback) noexcept
 {
+    traverseRange(0u, _entities.size(), std::forward<Callback>(callback));
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, ComponentType &>
+        || std::is_invocable_v<Callback, kF::ECS::Entity>
+        || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::traverseParallel(
+        Flow::Scheduler &scheduler, Callback &&callback, const EntityIndex grainSize) noexcept
+{
+    kFAssert(grainSize != 0,
+        "ECS::ComponentTable::traverseParallel: Grain size cannot be null");
+
+    const auto count = _entities.size();
+
+    // Small tables are not worth task scheduling overhead
+    if (count <= grainSize) [[unlikely]] {
+        traverseRange(0u, count, callback);
+        return;
+    }
+
+    // Record one task per chunk then block until every chunk completed
+    Flow::Graph graph;
+    for (EntityIndex from {}; from < count; from += grainSize) {
+        const auto to = std::min(from + grainSize, count);
+        graph.add([this, &callback, from, to] { traverseRange(from, to, callback); });
+    }
+    scheduler.schedule(graph);
+    graph.waitSpin();
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, ComponentType &>
+        || std::is_invocable_v<Callback, kF::ECS::Entity>
+        || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::recordTraverseParallel(
+        Flow::Graph &graph, const Callback &callback, const EntityIndex taskCount) noexcept
+{
+    kFAssert(taskCount != 0,
+        "ECS::ComponentTable::recordTraverseParallel: Task count cannot be null");
+
+    for (EntityIndex taskIndex {}; taskIndex != taskCount; ++taskIndex) {
+        graph.add([this, callback, taskIndex, taskCount](void) mutable {
+            // Compute the slice at execution time so the recorded graph follows table mutations
+            const auto count = static_cast<std::size_t>(_entities.size());
+            const auto from = static_cast<EntityIndex>(count * taskIndex / taskCount);
+            const auto to = static_cast<EntityIndex>(count * (taskIndex + 1u) / taskCount);
+            traverseRange(from, to, callback);
+        });
+    }
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, std::span<const kF::ECS::Entity>, std::span<ComponentType>>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::forEachChunk(Callback &&callback) noexcept
+{
+    static_assert(!IsTagComponent, "ECS::ComponentTable::forEachChunk: Tag components have no component storage to chunk");
+
+    if (const auto count = _entities.size(); count) [[likely]]
+        callback(std::span<const Entity>(_entities.data(), count), std::span<ComponentType>(_components.data(), count));
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, std::span<const kF::ECS::Entity>, std::span<const ComponentType>>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::forEachChunk(Callback &&callback) const noexcept
+{
+    static_assert(!IsTagComponent, "ECS::ComponentTable::forEachChunk: Tag components have no component storage to chunk");
+
+    if (const auto count = _entities.size(); count) [[likely]]
+        callback(std::span<const Entity>(_entities.data(), count), std::span<const ComponentType>(_components.data(), count));
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+template<typename Writer>
+    requires std::is_invocable_v<Writer, const void *, std::size_t>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::serialize(Writer &&writer) const noexcept
+{
+    static_assert(std::is_trivially_copyable_v<ComponentType>,
+        "ECS::ComponentTable::serialize: Component must be trivially copyable");
+
+    const TableSnapshotHeader header { .magic = TableSnapshotMagic, .count = _entities.size() };
+    writer(&header, sizeof(header));
+    writer(_entities.data(), _entities.size() * sizeof(Entity));
+    if constexpr (!IsTagComponent)
+        writer(_components.data(), _components.size() * sizeof(ComponentType));
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+template<typename Reader>
+    requires std::is_invocable_v<Reader, void *, std::size_t>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::deserialize(Reader &&reader) noexcept
+{
+    static_assert(std::is_trivially_copyable_v<ComponentType>,
+        "ECS::ComponentTable::deserialize: Component must be trivially copyable");
+
+    clear();
+    TableSnapshotHeader header;
+    reader(&header, sizeof(header));
+    kFEnsure(header.magic == TableSnapshotMagic,
+        "ECS::ComponentTable::deserialize: Invalid snapshot header");
+    const auto count = header.count;
+    if (!count) [[unlikely]]
+        return;
+
+    // Bulk load the dense arrays
+    _entities.insertCustom(_entities.end(), count, [&reader](const auto count, const auto out) {
+        reader(out, count * sizeof(Entity));
+    });
+    if constexpr (!IsTagComponent) {
+        _components.insertCustom(_components.end(), count, [&reader](const auto count, const auto data) {
+            reader(data, count * sizeof(ComponentType));
+        });
+    }
+    if constexpr (ChangeTracking) {
+        _versionState.versions.insertCustom(_versionState.versions.end(), count,
+            [current = _versionState.current](const auto count, const auto data) {
+                for (EntityIndex index {}; index != count; ++index)
+                    data[index] = current;
+            });
+    }
+
+    // Rebuild the index sparse set
+    for (EntityIndex index {}; index != count; ++index)
+        _indexSet.add(_entities.at(index), index);
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, ComponentType &>
+        || std::is_invocable_v<Callback, kF::ECS::Entity>
+        || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::traverseChanged(Callback &&callback) noexcept
+{
+    static_assert(ChangeTracking, "ECS::ComponentTable::traverseChanged: Component must be declared Tracked to enable change tracking");
+
     for (EntityIndex index {}, count = _entities.size(); index != count; ++index) {
+        if (_versionState.versions.at(index) <= _versionState.traversed)
+            continue;
+        // Entity & Component
+        if constexpr (std::is_invocable_v<Callback, Entity, ComponentType &>) {
+            if constexpr (std::is_same_v<std::invoke_result_t<Callback, Entity, ComponentType &>, bool>) {
+                if (!callback(_entities.at(index), atIndex(index)))
+                    break;
+            } else
+                callback(_entities.at(index), atIndex(index));
+        // Component only
+        } else if constexpr (std::is_invocable_v<Callback, ComponentType &>) {
+            if constexpr (std::is_same_v<std::invoke_result_t<Callback, ComponentType &>, bool>) {
+                if (!callback(atIndex(index)))
+                    break;
+            } else
+                callback(atIndex(index));
+        // Entity only
+        } else {
+            if constexpr (std::is_same_v<std::invoke_result_t<Callback, Entity>, bool>) {
+                if (!callback(_entities.at(index)))
+                    break;
+            } else
+                callback(_entities.at(index));
+        }
+    }
+
+    // Every component stamped up to now is considered visited
+    _versionState.traversed = _versionState.current;
+    ++_versionState.current;
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, bool ChangeTracking>
+template<typename Callback>
+inline void kF::ECS::ComponentTable<ComponentType, EntityPageSize, Allocator, ChangeTracking>::traverseRange(
+        const EntityIndex from, const EntityIndex to, Callback &&callback) noexcept
+{
+    for (EntityIndex index = from, count = to; index != count; ++index) {
         // Entity & Component
         if constexpr (std::is_invocable_v<Callback, Entity, ComponentType &>) {
             if constexpr (std::is_same_v<std::invoke_result_t<Callback, Entity, ComponentType &>, bool>) {
-                if (!callback(_entities.at(index), _components.at(index)))
+                if (!callback(_entities.at(index), atIndex(index)))
                     break;
             } else
-                callback(_entities.at(index), _components.at(index));
+                callback(_entities.at(index), atIndex(index));
         // Component only
         } else if constexpr (std::is_invocable_v<Callback, ComponentType &>) {
             if constexpr (std::is_same_v<std::invoke_result_t<Callback, ComponentType &>, bool>) {
-                if (!callback(_components.at(index)))
+                if (!callback(atIndex(index)))
                     break;
             } else
-                callback(_components.at(index));
+                callback(atIndex(index));
         // Entity only
         } else {
             if constexpr (std::is_same_v<std::invoke_result_t<Callback, Entity>, bool>) {
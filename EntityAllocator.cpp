@@ -0,0 +1,91 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Entity allocator
+ */
+
+#include "EntityAllocator.hpp"
+
+using namespace kF;
+
+ECS::Entity ECS::EntityAllocator::allocate(void) noexcept
+{
+    Entity entity;
+
+    if (_freeRanges.empty()) [[likely]]
+        entity = ++_lastEntity;
+    else {
+        auto &freeRange = _freeRanges.back();
+        entity = freeRange.begin++;
+        if (freeRange.begin == freeRange.end) [[unlikely]]
+            _freeRanges.pop();
+    }
+    return entity;
+}
+
+ECS::EntityRange ECS::EntityAllocator::allocateRange(const Entity count) noexcept
+{
+    // First fit scan over the sorted free set
+    for (auto it = _freeRanges.begin(), end = _freeRanges.end(); it != end; ++it) {
+        if (it->size() < count) [[likely]]
+            continue;
+        const EntityRange range { .begin = it->begin, .end = it->begin + count };
+        it->begin += count;
+        if (it->begin == it->end) [[unlikely]]
+            _freeRanges.erase(it);
+        return range;
+    }
+
+    // No free range fits, extend the allocation horizon
+    const EntityRange range { .begin = _lastEntity + 1u, .end = _lastEntity + 1u + count };
+    _lastEntity += count;
+    return range;
+}
+
+void ECS::EntityAllocator::releaseRange(const EntityRange range) noexcept
+{
+    // Stale handle detection relies on released entities changing generation
+    bumpGenerations(range);
+
+    // Releasing the allocation tail directly shrinks the horizon
+    if (range.end - 1u == _lastEntity) [[likely]] {
+        _lastEntity = range.begin - 1u;
+        // Absorb a free range that now touches the tail
+        if (!_freeRanges.empty() && _freeRanges.back().end == range.begin) [[unlikely]] {
+            _lastEntity = _freeRanges.back().begin - 1u;
+            _freeRanges.pop();
+        }
+        return;
+    }
+
+    // Find the first free range placed after the released one
+    const auto it = std::upper_bound(_freeRanges.begin(), _freeRanges.end(), range,
+        [](const EntityRange &lhs, const EntityRange &rhs) { return lhs.begin < rhs.begin; });
+    const auto prev = it != _freeRanges.begin() ? it - 1 : _freeRanges.end();
+
+    // Coalesce with both, left or right neighbor ranges
+    const bool mergeLeft = prev != _freeRanges.end() && prev->end == range.begin;
+    const bool mergeRight = it != _freeRanges.end() && range.end == it->begin;
+    if (mergeLeft & mergeRight) {
+        prev->end = it->end;
+        _freeRanges.erase(it);
+    } else if (mergeLeft)
+        prev->end = range.end;
+    else if (mergeRight)
+        it->begin = range.begin;
+    else
+        _freeRanges.insert(it, range);
+}
+
+void ECS::EntityAllocator::bumpGenerations(const EntityRange range) noexcept
+{
+    // Grow lazily so never released entities stay at generation zero
+    if (range.end > _generations.size()) [[likely]] {
+        _generations.insertCustom(_generations.end(), range.end - _generations.size(),
+            [](const auto count, const auto data) {
+                for (EntityIndex index {}; index != count; ++index)
+                    data[index] = EntityGeneration {};
+            });
+    }
+    for (auto entity = range.begin; entity != range.end; ++entity)
+        ++_generations.at(entity);
+}
@@ -0,0 +1,64 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Entity allocator
+ */
+
+#pragma once
+
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    class EntityAllocator;
+}
+
+/** @brief Entity identifier allocator backed by a sorted set of free ranges
+ *  @note Single allocation is O(1), release is O(log ranges) thanks to binary search and coalesces
+ *  with both neighbor ranges automatically, range allocation is a first fit scan over the sorted set */
+class kF::ECS::EntityAllocator
+{
+public:
+    /** @brief Allocate a single entity */
+    [[nodiscard]] Entity allocate(void) noexcept;
+
+    /** @brief Allocate a contiguous range of entities */
+    [[nodiscard]] EntityRange allocateRange(const Entity count) noexcept;
+
+
+    /** @brief Release a single entity */
+    inline void release(const Entity entity) noexcept
+        { releaseRange(EntityRange { .begin = entity, .end = entity + 1u }); }
+
+    /** @brief Release a contiguous range of entities */
+    void releaseRange(const EntityRange range) noexcept;
+
+
+    /** @brief Get the highest entity ever allocated */
+    [[nodiscard]] inline Entity lastEntity(void) const noexcept { return _lastEntity; }
+
+    /** @brief Get the sorted set of free entity ranges below the allocation horizon */
+    [[nodiscard]] inline const auto &freeRanges(void) const noexcept { return _freeRanges; }
+
+
+    /** @brief Get the generation of an entity, bumped every time the entity is released */
+    [[nodiscard]] inline EntityGeneration generation(const Entity entity) const noexcept
+        { return entity < _generations.size() ? _generations.at(entity) : EntityGeneration {}; }
+
+    /** @brief Make a versioned handle out of an entity */
+    [[nodiscard]] inline EntityHandle makeHandle(const Entity entity) const noexcept
+        { return EntityHandle { .entity = entity, .generation = generation(entity) }; }
+
+    /** @brief Check if a versioned handle still references the entity it was made from */
+    [[nodiscard]] inline bool isAlive(const EntityHandle handle) const noexcept
+        { return handle.entity != NullEntity && handle.generation == generation(handle.entity); }
+
+private:
+    /** @brief Bump the generation of every entity of a released range */
+    void bumpGenerations(const EntityRange range) noexcept;
+
+    Entity _lastEntity {};
+    Core::Vector<EntityRange, ECSAllocator> _freeRanges {};
+    Core::Vector<EntityGeneration, ECSAllocator> _generations {};
+};
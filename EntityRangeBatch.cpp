@@ -0,0 +1,28 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Entity range batch
+ */
+
+#include <algorithm>
+
+#include "EntityRangeBatch.hpp"
+
+using namespace kF;
+
+void ECS::EntityRangeBatch::coalesce(void) noexcept
+{
+    if (_ranges.size() < 2u) [[unlikely]]
+        return;
+
+    // Sort by range begin then merge overlapping or adjacent neighbors in place
+    std::sort(_ranges.begin(), _ranges.end(),
+        [](const EntityRange &lhs, const EntityRange &rhs) { return lhs.begin < rhs.begin; });
+    auto out = _ranges.begin();
+    for (auto it = out + 1, end = _ranges.end(); it != end; ++it) {
+        if (it->begin <= out->end)
+            out->end = std::max(out->end, it->end);
+        else
+            *++out = *it;
+    }
+    _ranges.erase(out + 1, _ranges.end());
+}
@@ -0,0 +1,56 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Entity range batch
+ */
+
+#pragma once
+
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    class EntityRangeBatch;
+}
+
+/** @brief Accumulator of structural change notifications, coalesced into entity ranges
+ *  @note Systems record affected entities during their tick then deliver the whole batch as a
+ *  single cross pipeline event through System::notifyRanges instead of one event per entity */
+class kF::ECS::EntityRangeBatch
+{
+public:
+    /** @brief List of coalesced ranges */
+    using Ranges = Core::Vector<EntityRange, ECSAllocator>;
+
+
+    /** @brief Record a single entity */
+    inline void add(const Entity entity) noexcept
+        { _ranges.push(EntityRange { .begin = entity, .end = entity + 1u }); }
+
+    /** @brief Record a range of entities */
+    inline void add(const EntityRange range) noexcept { _ranges.push(range); }
+
+
+    /** @brief Check if the batch contains no recorded entity */
+    [[nodiscard]] inline bool empty(void) const noexcept { return _ranges.empty(); }
+
+    /** @brief Sort recorded ranges and merge overlapping or adjacent ones */
+    void coalesce(void) noexcept;
+
+    /** @brief Get the recorded ranges, only sorted and merged after 'coalesce' */
+    [[nodiscard]] inline const Ranges &ranges(void) const noexcept { return _ranges; }
+
+    /** @brief Coalesce then move the ranges out, leaving the batch empty */
+    [[nodiscard]] inline Ranges take(void) noexcept
+    {
+        coalesce();
+        return std::move(_ranges);
+    }
+
+    /** @brief Clear recorded ranges */
+    inline void clear(void) noexcept { _ranges.clear(); }
+
+private:
+    Ranges _ranges {};
+};
@@ -3,6 +3,8 @@
  * @ Description: System Scheduler
  */
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <limits>
 #include <thread>
@@ -16,38 +18,41 @@ using namespace kF;
 
 static void PreciseSleep(const std::int64_t nanoseconds) noexcept;
 
+static void PinCurrentThread(const std::size_t coreId) noexcept;
+
 ECS::Executor *ECS::Executor::_Instance {};
 
+thread_local ECS::Executor *ECS::Executor::_Constructing {};
+
 ECS::Executor::~Executor(void) noexcept
 {
     kFEnsure(!_cache.running,
         "Executor::~Executor: Executor destroyed while still running");
-    kFEnsure(_Instance,
-        "ECS::Executor: Executor already destroyed");
-    _Instance = nullptr;
+    if (_Instance == this)
+        _Instance = nullptr;
 }
 
-ECS::Executor::Executor(const std::size_t workerCount, const std::size_t taskQueueSize, const std::size_t eventQueueSize) noexcept
+ECS::Executor::Executor(const std::size_t workerCount, const std::size_t taskQueueSize, const std::size_t eventQueueSize,
+        const ExecutorWaitMode waitMode) noexcept
     : _scheduler(workerCount, taskQueueSize), _eventQueue(eventQueueSize, false)
 {
-    kFEnsure(!_Instance,
-        "ECS::Executor: Executor can only be instantiated once");
-    _Instance = this;
+    // The first constructed executor becomes the default instance
+    if (!_Instance)
+        _Instance = this;
+    _cache.waitMode = waitMode;
+    _cache.workerCount = workerCount != Flow::Scheduler::AutoWorkerCount
+        ? workerCount : static_cast<std::size_t>(std::thread::hardware_concurrency());
 }
 
 Core::Expected<ECS::PipelineIndex> ECS::Executor::getPipelineIndex(const Core::HashedName pipelineHash) const noexcept
 {
     Core::Expected<PipelineIndex> res;
 
-    for (PipelineIndex index = 0u; const auto hash : _pipelines.hashes) {
-        if (hash != pipelineHash) [[likely]] {
-            ++index;
-            continue;
-        } else [[unlikely]] {
-            res = Core::Expected<PipelineIndex>(index);
-            break;
-        }
-    }
+    // Binary search over the sorted pipeline lookup
+    const auto &lookup = _pipelines.pipelineLookup;
+    const auto it = std::lower_bound(lookup.begin(), lookup.end(), pipelineHash);
+    if (it != lookup.end() && it->hash == pipelineHash) [[likely]]
+        res = Core::Expected<PipelineIndex>(it->index);
     return res;
 }
 
@@ -55,17 +60,11 @@ Core::Expected<ECS::PipelineIndex> ECS::Executor::getSystemIndex(const PipelineI
 {
     Core::Expected<PipelineIndex> res;
 
-    // Find system inside pipeline
-    auto &names = _pipelines.systemHashes.at(pipelineIndex);
-    for (PipelineIndex index = 0; const auto name : names) {
-        if (name != systemHash) [[likely]] {
-            ++index;
-            continue;
-        } else [[unlikely]] {
-            res = Core::Expected<PipelineIndex>(index);
-            break;
-        }
-    }
+    // Binary search over the sorted system lookup of the pipeline
+    const auto &lookup = _pipelines.systemLookups.at(pipelineIndex);
+    const auto it = std::lower_bound(lookup.begin(), lookup.end(), systemHash);
+    if (it != lookup.end() && it->hash == systemHash) [[likely]]
+        res = Core::Expected<PipelineIndex>(it->index);
     return res;
 }
 
@@ -75,6 +74,32 @@ void ECS::Executor::setPipelineTickRate(const PipelineIndex pipelineIndex, const
     _pipelines.clocks.at(pipelineIndex).setTickRate(HzToRate(frequencyHz));
 }
 
+void ECS::Executor::setWorkerAffinity(const std::span<const std::size_t> coreIds) noexcept
+{
+    kFEnsure(!coreIds.empty(),
+        "ECS::Executor::setWorkerAffinity: Core id list cannot be empty");
+    // More pinning tasks than workers would deadlock the claim barrier
+    kFEnsure(coreIds.size() <= _cache.workerCount,
+        "ECS::Executor::setWorkerAffinity: Core id count '", coreIds.size(),
+        "' exceeds scheduler worker count '", _cache.workerCount, '\'');
+
+    // Record one pinning task per core id, a barrier guarantees each task occupies a distinct worker
+    std::atomic_size_t started { 0u };
+    std::atomic_size_t claimed { 0u };
+    const auto taskCount = coreIds.size();
+    Flow::Graph graph;
+    for (std::size_t index {}; index != taskCount; ++index) {
+        graph.add([&started, &claimed, coreIds, taskCount] {
+            ++started;
+            while (started.load() != taskCount)
+                std::this_thread::yield();
+            PinCurrentThread(coreIds[claimed.fetch_add(1u)]);
+        });
+    }
+    _scheduler.schedule(graph);
+    graph.waitSpin();
+}
+
 void ECS::Executor::stop(void) noexcept
 {
     const auto res = _eventQueue.push([this] {
@@ -136,18 +161,35 @@ void ECS::Executor::observePipelines(void) noexcept
         const auto tickRate = clock.tickRate(); // @todo fix this datarace when clock frequency changes at runtime (mutex / atomic)
         const bool isTimeBound = clock.isTimeBound();
         clock.elapsed += elapsed;
+        auto &graph = *_pipelines.graphs.at(pipelineIndex);
+        auto &owedTicks = _pipelines.owedTicks.at(pipelineIndex);
+        // Owed catch-up ticks replay back-to-back as soon as the graph is idle, without waiting
+        if (owedTicks) [[unlikely]] {
+            if (!graph.running()) {
+                --owedTicks;
+                if (const auto &inlineBeginPass = _pipelines.inlineBeginPasses.at(pipelineIndex); !inlineBeginPass || inlineBeginPass()) [[likely]]
+                    _scheduler.schedule(graph);
+            }
+            next = now;
         // If the pipeline has to be executed
-        if (clock.elapsed >= tickRate) [[unlikely]] {
+        } else if (clock.elapsed >= tickRate) [[unlikely]] {
             // If the graph is not being executed, schedule it
-            if (auto &graph = *_pipelines.graphs.at(pipelineIndex); !graph.running()) [[likely]] {
+            if (!graph.running()) [[likely]] {
                 // kFInfo("  Tick '", _pipelines.names.at(pipelineIndex), "': ", clock.elapsed / static_cast<double>(tickRate), " (", clock.elapsed, " / ", tickRate, ")");
-                if (isTimeBound)
-                    clock.elapsed -= tickRate;
-                else
+                if (isTimeBound) {
+                    // Convert the whole backlog into owed ticks at once, dropping debt beyond the cap
+                    auto owed = clock.elapsed / tickRate;
+                    if (owed > MaxCatchUpTicks) [[unlikely]] {
+                        owed = MaxCatchUpTicks;
+                        clock.elapsed = 0;
+                    } else
+                        clock.elapsed -= owed * tickRate;
+                    owedTicks = static_cast<std::uint32_t>(owed - 1);
+                } else
                     clock.elapsed = 0;
                 if (const auto &inlineBeginPass = _pipelines.inlineBeginPasses.at(pipelineIndex); !inlineBeginPass || inlineBeginPass()) [[likely]]
                     _scheduler.schedule(graph);
-                next = std::min(next, now + tickRate);
+                next = std::min(next, owedTicks ? now : now + tickRate);
             // Else we must schedule the graph as soon as it finishes execution
             } else {
                 // kFInfo("  Busy '", _pipelines.names.at(pipelineIndex), "': ", clock.elapsed / static_cast<double>(tickRate), " (", clock.elapsed, " / ", tickRate, ")");
@@ -173,6 +215,12 @@ void ECS::Executor::waitPipelines(void) noexcept
     if (seconds <= 0.0)
         return;
 
+    // Low power mode sleeps to the deadline in one OS wait, trading timer resolution jitter for idle CPU
+    if (_cache.waitMode == ExecutorWaitMode::LowPower) {
+        PreciseSleep(_cache.nextTick - now);
+        return;
+    }
+
     // Sleep wait
     // kFInfo("Sleeping for ", seconds * 1e3, " ms (", _cache.sleepEstimate * 1e3, ")");
     while (seconds > _cache.sleepEstimate) {
@@ -219,6 +267,10 @@ void ECS::Executor::buildPipelineGraph(const PipelineIndex pipelineIndex) noexce
 
     // The first taks of the pipeline executes events and tells if the pipeline can execute
     auto &beginTask = graph.add([this, pipelineIndex] {
+        // Recycle the tick scratch arena
+        if (auto &arena = _pipelines.tickArenas.at(pipelineIndex); arena) [[likely]]
+            arena->reset();
+
         // Process all pipeline events
         auto &queue = *_pipelines.events.at(pipelineIndex);
         PipelineEvent event;
@@ -236,24 +288,72 @@ void ECS::Executor::buildPipelineGraph(const PipelineIndex pipelineIndex) noexce
     if (systems.empty()) [[unlikely]]
         return;
 
-    Flow::Task *prevTickTask = &beginTask;
-    Flow::Task *prevGraphTask = nullptr;
+    // Two systems conflict when any component access is shared with at least one writer,
+    // a system without declared accesses conservatively conflicts with everyone
+    const auto conflicts = [](const Internal::ASystem &lhs, const Internal::ASystem &rhs) {
+        const auto lhsAccesses = lhs.componentAccesses();
+        const auto rhsAccesses = rhs.componentAccesses();
+        if (lhsAccesses.empty() || rhsAccesses.empty()) [[unlikely]]
+            return true;
+        for (const auto &lhsAccess : lhsAccesses) {
+            for (const auto &rhsAccess : rhsAccesses) {
+                if (lhsAccess.typeId == rhsAccess.typeId && (!lhsAccess.readOnly || !rhsAccess.readOnly))
+                    return true;
+            }
+        }
+        return false;
+    };
 
-    // For each system, record tick & graph tasks then link them to begin / end
-    for (auto &system : systems) {
-        auto &tickTask = graph.add([system = system.get()](void) -> bool { return !system->tick(); });
+    const auto &systemHashes = _pipelines.systemHashes.at(pipelineIndex);
+    const auto &systemOrders = _pipelines.systemOrders.at(pipelineIndex);
+    SystemSmallVector<Flow::Task *> graphTasks;
+
+    // For each system, record tick & graph tasks then only sequence after conflicting predecessors
+    for (PipelineIndex systemIndex {}; auto &system : systems) {
+        auto &tickTask = [&, this]() -> Flow::Task & {
+            // When profiling is compiled in, the tick task stamps the system execution start
+            if constexpr (SystemProfilingEnabled) {
+                return graph.add([this, system = system.get(), pipelineIndex, systemIndex](void) -> bool {
+                    _pipelines.statistics.at(pipelineIndex).at(systemIndex).start =
+                        std::chrono::high_resolution_clock::now().time_since_epoch().count();
+                    const bool cancelGraph = !system->tick();
+                    // A cancelling tick skips its graph and the epilogue task, record it now
+                    if (cancelGraph)
+                        recordSystemStatistics(pipelineIndex, systemIndex);
+                    return cancelGraph;
+                });
+            } else
+                return graph.add([system = system.get()](void) -> bool { return !system->tick(); });
+        }();
         auto &graphTask = graph.add(&system->taskGraph());
 
-        // Connect tick to previous tasks
-        tickTask.after(*prevTickTask);
-        if (prevGraphTask) [[likely]]
-            tickTask.after(*prevGraphTask);
+        // Connect tick to every conflicting predecessor
+        bool hasDependency = false;
+        for (PipelineIndex previousIndex {}; previousIndex != systemIndex; ++previousIndex) {
+            const auto explicitOrder = std::find_if(systemOrders.begin(), systemOrders.end(), [&](const SystemOrder &order) {
+                return order.before == systemHashes.at(previousIndex) && order.after == systemHashes.at(systemIndex);
+            }) != systemOrders.end();
+            if (explicitOrder || conflicts(*systems.at(previousIndex), *system)) {
+                tickTask.after(*graphTasks.at(previousIndex));
+                hasDependency = true;
+            }
+        }
+        // Roots are connected to the begin task
+        if (!hasDependency)
+            tickTask.after(beginTask);
         // Connect tick to its graph
         tickTask.before(graphTask);
 
-        // Set previous tasks
-        prevTickTask = &tickTask;
-        prevGraphTask = &graphTask;
+        // When profiling is compiled in, an epilogue task accumulates the system execution duration
+        if constexpr (SystemProfilingEnabled) {
+            auto &statisticsTask = graph.add([this, pipelineIndex, systemIndex] {
+                recordSystemStatistics(pipelineIndex, systemIndex);
+            });
+            statisticsTask.after(graphTask);
+        }
+
+        graphTasks.push(&graphTask);
+        ++systemIndex;
     }
 }
 
@@ -283,17 +383,31 @@ static void PreciseSleep(const std::int64_t nanoseconds) noexcept
     if (SetWaitableTimer(WindowsTimer.handle, &timeDef, 0, nullptr, nullptr, false)) [[likely]]
         WaitForSingleObject(WindowsTimer.handle, INFINITE);
 }
+
+static void PinCurrentThread(const std::size_t coreId) noexcept
+{
+    SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << coreId);
+}
 #else
 #include <time.h>
 static void PreciseSleep(const std::int64_t nanoseconds) noexcept
 {
     const struct timespec spec {
-        .tv_sec = time_t {},
-        .tv_nsec = nanoseconds
+        .tv_sec = static_cast<time_t>(nanoseconds / 1'000'000'000ll),
+        .tv_nsec = static_cast<long>(nanoseconds % 1'000'000'000ll)
     };
     struct timespec rem {};
     nanosleep(&spec, &rem);
 }
+
+#include <pthread.h>
+static void PinCurrentThread(const std::size_t coreId) noexcept
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(coreId, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
 #endif
 
 void ECS::Executor::waitIDLE(void) noexcept
@@ -301,3 +415,27 @@ void ECS::Executor::waitIDLE(void) noexcept
     for (auto &graph : _pipelines.graphs)
         graph->waitSpin();
 }
+
+void ECS::Executor::recordSystemStatistics(const PipelineIndex pipelineIndex, const PipelineIndex systemIndex) noexcept
+{
+    auto &statistics = _pipelines.statistics.at(pipelineIndex).at(systemIndex);
+    const auto elapsed = std::chrono::high_resolution_clock::now().time_since_epoch().count() - statistics.start;
+
+    statistics.record(elapsed);
+    if (_profilingHook) [[unlikely]]
+        _profilingHook(pipelineIndex, systemIndex, elapsed);
+}
+
+std::int64_t ECS::Executor::SystemStatistics::percentile(const double ratio) const noexcept
+{
+    const auto sampleCount = static_cast<std::size_t>(std::min<std::int64_t>(count, SampleCapacity));
+
+    if (!sampleCount) [[unlikely]]
+        return 0ll;
+    // Select over a scratch copy to keep the query const
+    std::array<std::int64_t, SampleCapacity> scratch;
+    std::copy_n(samples.begin(), sampleCount, scratch.begin());
+    const auto nth = scratch.begin() + static_cast<std::ptrdiff_t>(ratio * static_cast<double>(sampleCount - 1u));
+    std::nth_element(scratch.begin(), nth, scratch.begin() + sampleCount);
+    return *nth;
+}
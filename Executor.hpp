@@ -5,6 +5,10 @@
 
 #pragma once
 
+#include <array>
+#include <limits>
+#include <span>
+
 #include <Kube/Core/Expected.hpp>
 #include <Kube/Core/MPSCQueue.hpp>
 #include <Kube/Core/TrivialFunctor.hpp>
@@ -13,6 +17,7 @@
 
 #include "System.hpp"
 #include "PipelineEvent.hpp"
+#include "TickArena.hpp"
 
 #ifndef KUBE_ECS_PIPELINE_CACHE_COUNT
 # define KUBE_ECS_PIPELINE_CACHE_COUNT 4
@@ -22,6 +27,10 @@
 # define KUBE_ECS_PER_PIPELINE_SYSTEM_CACHE_COUNT 4
 #endif
 
+#ifndef KUBE_ECS_SYSTEM_PROFILING
+# define KUBE_ECS_SYSTEM_PROFILING 0
+#endif
+
 namespace kF::ECS
 {
     class Executor;
@@ -55,6 +64,13 @@ namespace kF::ECS
     /** @brief Helper used to set explicit dependency after a system */
     template<typename SystemType>
     constexpr auto RunAfter = Internal::TagAfter<SystemType>();
+
+    /** @brief Executor wait policies between pipeline ticks */
+    enum class ExecutorWaitMode : std::uint8_t
+    {
+        SpinAccurate,   // Estimated sleep then spin until the deadline, minimal jitter but keeps a core warm
+        LowPower        // Single OS sleep to the deadline, near zero idle CPU, jitter bound by timer resolution
+    };
 }
 
 class alignas_double_cacheline kF::ECS::Executor
@@ -66,6 +82,12 @@ public:
     /** @brief Pipeline begin pass (if returns false, the whole pipeline is ignored) */
     using PipelineBeginPass = Core::TrivialFunctor<bool(void)>;
 
+    /** @brief Profiling hook called with (pipelineIndex, systemIndex, nanoseconds) after each profiled system execution */
+    using ProfilingHook = Core::TrivialFunctor<void(PipelineIndex, PipelineIndex, std::int64_t)>;
+
+    /** @brief Compile time state of per system profiling (KUBE_ECS_SYSTEM_PROFILING) */
+    static constexpr bool SystemProfilingEnabled = KUBE_ECS_SYSTEM_PROFILING;
+
 
     /** @brief Default number of events in pipeline event queue */
     constexpr static std::size_t DefaultPipelineEventQueueSize = 4096 / sizeof(PipelineEvent);
@@ -77,6 +99,15 @@ public:
     constexpr static std::size_t ExecutorEventPopCount = Core::CacheLineSize / sizeof(ExecutorEvent);
 
 
+    /** @brief Default capacity of per pipeline tick arenas in bytes */
+    constexpr static std::size_t DefaultTickArenaCapacity = 1u << 20u;
+
+
+    /** @brief Maximum number of owed catch-up ticks a time bound pipeline can accumulate
+     *  @note Debt beyond the cap is dropped to prevent a death spiral after long stalls */
+    constexpr static std::int64_t MaxCatchUpTicks = 8;
+
+
     /** @brief Number of pipeline in optimized cache */
     constexpr static std::size_t OptimalPipelineCount = KUBE_ECS_PIPELINE_CACHE_COUNT;
 
@@ -104,6 +135,67 @@ public:
     /** @brief Store the graph of a pipeline */
     using PipelineGraph = Core::UniquePtr<Flow::Graph, ECSAllocator>;
 
+    /** @brief Store the tick arena of a pipeline */
+    using PipelineTickArena = Core::UniquePtr<TickArena, ECSAllocator>;
+
+    /** @brief Explicit order constraint between two systems of a pipeline */
+    struct alignas_quarter_cacheline SystemOrder
+    {
+        Core::HashedName before {};
+        Core::HashedName after {};
+    };
+
+    /** @brief Store the explicit system order constraints of a pipeline */
+    using PipelineSystemOrders = SystemSmallVector<SystemOrder>;
+
+    /** @brief Sorted hashed name to index lookup entry */
+    struct alignas_quarter_cacheline LookupEntry
+    {
+        Core::HashedName hash {};
+        PipelineIndex index {};
+
+        /** @brief Sort & search comparison operators over hash */
+        [[nodiscard]] inline bool operator<(const LookupEntry &other) const noexcept { return hash < other.hash; }
+        [[nodiscard]] inline bool operator<(const Core::HashedName other) const noexcept { return hash < other; }
+    };
+
+    /** @brief Store the sorted system lookup entries of a pipeline */
+    using PipelineSystemLookup = SystemSmallVector<LookupEntry>;
+
+    /** @brief Accumulated tick timing statistics of a system, durations are in nanoseconds */
+    struct alignas_double_cacheline SystemStatistics
+    {
+        /** @brief Number of retained samples for percentile queries */
+        static constexpr std::size_t SampleCapacity = 256;
+
+        std::int64_t start {};
+        std::int64_t min { std::numeric_limits<std::int64_t>::max() };
+        std::int64_t max {};
+        std::int64_t total {};
+        std::int64_t count {};
+        std::array<std::int64_t, SampleCapacity> samples {};
+
+        /** @brief Record an execution duration sample */
+        inline void record(const std::int64_t duration) noexcept
+        {
+            min = std::min(min, duration);
+            max = std::max(max, duration);
+            total += duration;
+            samples[static_cast<std::size_t>(count) % SampleCapacity] = duration;
+            ++count;
+        }
+
+        /** @brief Get mean execution duration */
+        [[nodiscard]] inline std::int64_t mean(void) const noexcept { return count ? total / count : 0ll; }
+
+        /** @brief Get an approximate percentile over the retained samples, 'ratio' is in range [0, 1] */
+        [[nodiscard]] std::int64_t percentile(const double ratio) const noexcept;
+    };
+
+    /** @brief Store the statistics of every system of a pipeline
+     *  @note Plain vector to stay allocation free while profiling is disabled */
+    using PipelineStatistics = Core::Vector<SystemStatistics, ECSAllocator>;
+
     /** @brief Store the clock of a pipeline */
     struct alignas_quarter_cacheline PipelineClock
     {
@@ -131,7 +223,13 @@ public:
         PipelineSmallVector<PipelineEvents>         events {};
         PipelineSmallVector<PipelineSystemNames>    systemHashes {};
         PipelineSmallVector<PipelineSystems>        systems {};
+        PipelineSmallVector<PipelineSystemOrders>   systemOrders {};
+        PipelineSmallVector<LookupEntry>            pipelineLookup {};
+        PipelineSmallVector<PipelineSystemLookup>   systemLookups {};
+        PipelineSmallVector<PipelineStatistics>     statistics {};
         PipelineSmallVector<PipelineClock>          clocks {};
+        PipelineSmallVector<std::uint32_t>          owedTicks {};
+        PipelineSmallVector<PipelineTickArena>      tickArenas {};
         PipelineSmallVector<PipelineGraph>          graphs {};
         PipelineSmallVector<PipelineBeginPass>      inlineBeginPasses {};
         PipelineSmallVector<PipelineBeginPass>      beginPasses {};
@@ -143,6 +241,8 @@ public:
     struct alignas_double_cacheline Cache
     {
         bool running { false };
+        ExecutorWaitMode waitMode { ExecutorWaitMode::SpinAccurate };
+        std::size_t workerCount {};
         std::int64_t lastTick {};
         std::int64_t nextTick {};
         double sleepEstimate { 5e-3 };
@@ -153,17 +253,21 @@ public:
     static_assert_fit_double_cacheline(Cache);
 
 
-    /** @brief Get global instance */
+    /** @brief Get the default executor instance (the first one constructed)
+     *  @note Multiple executors may coexist to run independent worlds, each system belongs to the
+     *  executor that constructed it and only falls back to the default instance outside addSystem */
     [[nodiscard]] static inline Executor &Get(void) noexcept { return *_Instance; }
 
 
     /** @brief Destructor */
     ~Executor(void) noexcept;
 
-    /** @brief Construct scheduler with a maximum amount of workers, tasks and events */
+    /** @brief Construct scheduler with a maximum amount of workers, tasks and events
+     *  @note The wait mode selects how the executor waits between pipeline ticks */
     Executor(const std::size_t workerCount = Flow::Scheduler::AutoWorkerCount,
             const std::size_t taskQueueSize = Flow::Scheduler::DefaultTaskQueueSize,
-            const std::size_t eventQueueSize = DefaultExecutorEventQueueSize) noexcept;
+            const std::size_t eventQueueSize = DefaultExecutorEventQueueSize,
+            const ExecutorWaitMode waitMode = ExecutorWaitMode::SpinAccurate) noexcept;
 
 
     /** @brief Get reference to graph scheduler */
@@ -171,6 +275,18 @@ public:
     [[nodiscard]] inline const Flow::Scheduler &scheduler(void) const noexcept { return _scheduler; }
 
 
+    /** @brief Get the number of scheduler workers
+     *  @note Resolved from hardware concurrency when the executor was constructed with AutoWorkerCount */
+    [[nodiscard]] inline std::size_t workerCount(void) const noexcept { return _cache.workerCount; }
+
+
+    /** @brief Pin scheduler workers to the given core identifiers, one worker per entry
+     *  @note Workers are claimed through a barrier so each entry lands on a distinct worker, the
+     *  entry count must not exceed 'workerCount'
+     *  @note Must be called while no pipeline graph is running, typically right after construction */
+    void setWorkerAffinity(const std::span<const std::size_t> coreIds) noexcept;
+
+
     /** @brief Run the executor in blocking mode */
     void run(void) noexcept;
 
@@ -181,11 +297,13 @@ public:
     void stop(void) noexcept;
 
 
-    /** @brief Add a pipeline into executor */
+    /** @brief Add a pipeline into executor
+     *  @note A null tick arena capacity disables the pipeline's scratch arena */
     template<kF::ECS::Pipeline PipelineType, PipelineTimeMode TimeMode = PipelineTimeMode::Free,
             typename BeginPass = PipelineBeginPass, typename InlineBeginPass = PipelineBeginPass>
     void addPipeline(const std::int64_t frequencyHz, const std::size_t eventQueueSize = DefaultPipelineEventQueueSize,
-            BeginPass &&beginPass = PipelineBeginPass {}, InlineBeginPass &&inlineBeginPass = PipelineBeginPass {}) noexcept;
+            BeginPass &&beginPass = PipelineBeginPass {}, InlineBeginPass &&inlineBeginPass = PipelineBeginPass {},
+            const std::size_t tickArenaCapacity = DefaultTickArenaCapacity) noexcept;
 
     /** @brief Alias to add pipeline without custom event queue size */
     template<kF::ECS::Pipeline PipelineType, PipelineTimeMode TimeMode = PipelineTimeMode::Free,
@@ -249,10 +367,47 @@ public:
     template<bool RetryOnFailure = true, typename Callback>
     void sendEvent(const PipelineIndex pipelineIndex, Callback &&callback) noexcept;
 
+
+    /** @brief Send a batch of events to a pipeline, resolving the destination only once
+     *  @note Events are moved from the span into the destination queue */
+    template<typename DestinationPipeline, bool RetryOnFailure = true>
+    void sendEvents(const std::span<PipelineEvent> events) noexcept;
+
+    /** @brief Send a batch of events to a pipeline, using a specific pipeline index
+     *  @note Events are moved from the span into the destination queue */
+    template<bool RetryOnFailure = true>
+    void sendEvents(const PipelineIndex pipelineIndex, const std::span<PipelineEvent> events) noexcept;
+
+
+    /** @brief Get the tick scratch arena of a pipeline
+     *  @note Aborts if the pipeline was registered without an arena */
+    [[nodiscard]] inline TickArena &tickArena(const PipelineIndex pipelineIndex) noexcept
+    {
+        auto &arena = _pipelines.tickArenas.at(pipelineIndex);
+        kFEnsure(arena,
+            "ECS::Executor::tickArena: Pipeline '", _pipelines.names.at(pipelineIndex), "' has no tick arena");
+        return *arena;
+    }
+
+
+    /** @brief Get accumulated statistics of every system of a pipeline, ordered by system index
+     *  @note Empty unless compiled with KUBE_ECS_SYSTEM_PROFILING */
+    [[nodiscard]] inline const PipelineStatistics &statistics(const PipelineIndex pipelineIndex) const noexcept
+        { return _pipelines.statistics.at(pipelineIndex); }
+
+    /** @brief Set the profiling hook forwarding each timing sample to an external profiler */
+    inline void setProfilingHook(ProfilingHook &&hook) noexcept { _profilingHook = std::move(hook); }
+
 private:
-    // Global access instance
+    /** @brief ASystem binds itself to the constructing executor */
+    friend Internal::ASystem;
+
+    // Default access instance (first constructed executor)
     static Executor *_Instance;
 
+    // Executor whose addSystem is currently constructing systems on this thread
+    static thread_local Executor *_Constructing;
+
     // Cacheline 0 -> 13
     Flow::Scheduler _scheduler {};
 
@@ -265,6 +420,18 @@ private:
     // Cacheline 20 -> ... (depend on 'OptimalPipelineCount')
     Pipelines _pipelines {};
 
+    // Profiling hook, only invoked when system profiling is compiled in
+    ProfilingHook _profilingHook {};
+
+    /** @brief Push a single event into a pipeline queue honoring the retry policy */
+    template<bool RetryOnFailure>
+    void pushEvent(const PipelineIndex pipelineIndex, PipelineEvent &event) noexcept;
+
+
+    /** @brief Record the elapsed execution duration of a system and forward it to the profiling hook */
+    void recordSystemStatistics(const PipelineIndex pipelineIndex, const PipelineIndex systemIndex) noexcept;
+
+
     /** @brief Process executor events */
     [[nodiscard]] bool processEvents(void) noexcept;
 
@@ -11,13 +11,21 @@
 
 template<kF::ECS::Pipeline PipelineType, kF::ECS::PipelineTimeMode TimeMode, typename BeginPass, typename InlineBeginPass>
 inline void kF::ECS::Executor::addPipeline(const std::int64_t frequencyHz, const std::size_t eventQueueSize,
-        BeginPass &&beginPass, InlineBeginPass &&inlineBeginPass) noexcept
+        BeginPass &&beginPass, InlineBeginPass &&inlineBeginPass, const std::size_t tickArenaCapacity) noexcept
 {
     kFEnsure(frequencyHz >= 0, "ECS::Executor::addPipeline: Pipeline only support frequency in range [0, inf[");
 
     _pipelines.hashes.push(PipelineType::Hash);
     _pipelines.systemHashes.push();
     _pipelines.systems.push();
+    _pipelines.systemOrders.push();
+    _pipelines.systemLookups.push();
+    _pipelines.statistics.push();
+    // Keep the pipeline lookup sorted by hash
+    _pipelines.pipelineLookup.insert(
+        std::lower_bound(_pipelines.pipelineLookup.begin(), _pipelines.pipelineLookup.end(), PipelineType::Hash),
+        LookupEntry { .hash = PipelineType::Hash, .index = static_cast<PipelineIndex>(_pipelines.hashes.size() - 1u) }
+    );
     _pipelines.events.push(eventQueueSize ? PipelineEvents::Make(eventQueueSize) : PipelineEvents());
     _pipelines.clocks.push(PipelineClock {
         .maskedTickRate = [tickRate = HzToRate(frequencyHz)] {
@@ -27,6 +35,8 @@ inline void kF::ECS::Executor::addPipeline(const std::int64_t frequencyHz, const
                 return tickRate;
         }(),
     });
+    _pipelines.owedTicks.push(0u);
+    _pipelines.tickArenas.push(tickArenaCapacity ? PipelineTickArena::Make(tickArenaCapacity) : PipelineTickArena());
     _pipelines.graphs.push(PipelineGraph::Make());
     _pipelines.inlineBeginPasses.push(std::forward<InlineBeginPass>(inlineBeginPass));
     _pipelines.beginPasses.push(std::forward<BeginPass>(beginPass));
@@ -51,6 +61,17 @@ inline SystemType &kF::ECS::Executor::addSystem(Args &&...args) noexcept
     auto insertAt = systemNames.end();
     // Scan dependencies
     if constexpr (sizeof...(Dependencies) != 0) {
+        // Record explicit order constraints for graph building
+        auto &orders = _pipelines.systemOrders.at(*expected);
+        const auto record = [&orders]<typename DependencyHolder>(DependencyHolder) {
+            using Dependency = DependencyHolder::Type;
+            if constexpr (DependencyHolder::After)
+                orders.push(SystemOrder { .before = Dependency::Hash, .after = SystemType::Hash });
+            else
+                orders.push(SystemOrder { .before = SystemType::Hash, .after = Dependency::Hash });
+        };
+        (record(Dependencies), ...);
+
         kFEnsure(insertAt != nullptr,
             "ECS::Executor::addSystem: System '", SystemType::Name, "' is added before its dependencies");
         auto orderFunc = [&systemNames]<typename DependencyHolder>(auto &insertAt, DependencyHolder) {
@@ -83,16 +104,33 @@ inline SystemType &kF::ECS::Executor::addSystem(Args &&...args) noexcept
         }
     }
 
-    // Insert system & system name
+    // Insert system & system name, routing ASystem constructors to this executor
     const auto insertIndex = std::distance(systemNames.begin(), insertAt);
     systemNames.insert(
         insertAt,
         SystemType::Hash
     );
+    _Constructing = this;
     const auto systemIt = systems.insert(
         systems.begin() + insertIndex,
         SystemPtr::Make<SystemType>(std::forward<Args>(args)...)
     );
+    _Constructing = nullptr;
+
+    // Insert the statistics block of the system when profiling is compiled in
+    if constexpr (SystemProfilingEnabled) {
+        auto &statistics = _pipelines.statistics.at(*expected);
+        statistics.insert(statistics.begin() + insertIndex, SystemStatistics {});
+    }
+
+    // Rebuild the sorted system lookup, insertion shifted every subsequent system index
+    auto &lookup = _pipelines.systemLookups.at(*expected);
+    lookup.clear();
+    for (PipelineIndex index {}; const auto hash : systemNames) {
+        lookup.push(LookupEntry { .hash = hash, .index = index });
+        ++index;
+    }
+    std::sort(lookup.begin(), lookup.end());
 
     // Return reinterpreted system
     return reinterpret_cast<SystemType &>(**systemIt);
@@ -153,10 +191,35 @@ inline void kF::ECS::Executor::sendEvent(const std::uint32_t pipelineIndex, Call
     } else
         pipelineEvent = std::forward<Callback>(callback);
 
+    pushEvent<RetryOnFailure>(pipelineIndex, pipelineEvent);
+}
+
+template<typename DestinationPipeline, bool RetryOnFailure>
+inline void kF::ECS::Executor::sendEvents(const std::span<PipelineEvent> events) noexcept
+{
+    // Query destination pipeline index
+    const auto pipelineIndex = getPipelineIndex(DestinationPipeline::Hash);
+    kFEnsure(pipelineIndex.success(),
+        "ECS::Executor::sendEvents: Couldn't find pipeline '", DestinationPipeline::Name, '\'');
+    sendEvents<RetryOnFailure>(*pipelineIndex, events);
+}
+
+template<bool RetryOnFailure>
+inline void kF::ECS::Executor::sendEvents(const PipelineIndex pipelineIndex, const std::span<PipelineEvent> events) noexcept
+{
+    for (auto &event : events)
+        pushEvent<RetryOnFailure>(pipelineIndex, event);
+}
+
+template<bool RetryOnFailure>
+inline void kF::ECS::Executor::pushEvent(const PipelineIndex pipelineIndex, PipelineEvent &event) noexcept
+{
+    auto &queue = *_pipelines.events.at(pipelineIndex);
+
     // When RetryOnFailure is set to true, loop until event is pushed
     bool res = false;
     while (true) {
-        res = _pipelines.events.at(pipelineIndex)->push<true>(pipelineEvent);
+        res = queue.push<true>(event);
         if constexpr (RetryOnFailure) {
             if (!res) {
                 std::this_thread::yield();
@@ -165,5 +228,5 @@ inline void kF::ECS::Executor::sendEvent(const std::uint32_t pipelineIndex, Call
         }
         break;
     }
-    kFEnsure(res, "Executor::sendEvent: Critical error, event queue is full");
+    kFEnsure(res, "Executor::pushEvent: Critical error, event queue is full");
 }
\ No newline at end of file
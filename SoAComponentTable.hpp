@@ -0,0 +1,189 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SoA component table
+ */
+
+#pragma once
+
+#include <span>
+#include <tuple>
+
+#include <Kube/Core/SparseSet.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+    class SoAComponentTable;
+
+    namespace Internal
+    {
+        /** @brief Deduce the value type of a member pointer */
+        template<typename ClassType, typename MemberType>
+        MemberType MemberPointerValueType(MemberType ClassType::*);
+
+        /** @brief Value type behind a component field member pointer */
+        template<auto Member>
+        using SoAFieldType = decltype(MemberPointerValueType(Member));
+
+        /** @brief Compare two member pointers that may differ in type */
+        template<auto Lhs, auto Rhs>
+        constexpr bool IsSameMember = [] {
+            if constexpr (std::is_same_v<decltype(Lhs), decltype(Rhs)>)
+                return Lhs == Rhs;
+            else
+                return false;
+        }();
+    }
+}
+
+/** @brief Component table decomposing its component into one densely packed vector per listed field
+ *  @note Traversing a subset of fields only streams the touched vectors, keeping hot kernels on
+ *  whole cachelines of useful data. Components are scattered on insertion and gathered on 'get',
+ *  so there is no per entity component reference: use 'getField', 'field' spans or
+ *  'traverseFields' for direct access. Multi component 'query' and groups are not supported
+ *  @tparam Members Member pointers of the fields to store, every field the systems touch */
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+class alignas_cacheline kF::ECS::SoAComponentTable
+{
+public:
+    /** @brief Is table stable ? */
+    static constexpr bool IsStable = false;
+
+    /** @brief ComponentType of stored component */
+    using ValueType = ComponentType;
+
+    /** @brief Number of decomposed fields */
+    static constexpr std::size_t FieldCount = sizeof...(Members);
+
+    /** @brief Sparse set that stores indexes of entities' components */
+    using IndexSparseSet = Core::SparseSet<Entity, EntityPageSize, Allocator, EntityIndex, &Internal::EntityIndexInitializer>;
+
+    /** @brief List of entities */
+    using Entities = Core::Vector<Entity, Allocator, EntityIndex>;
+
+    /** @brief Tuple of field vectors */
+    using FieldsTuple = std::tuple<Core::Vector<Internal::SoAFieldType<Members>, Allocator, EntityIndex>...>;
+
+    /** @brief Index of a field inside the fields tuple */
+    template<auto Member>
+    static constexpr std::size_t FieldIndex = [] {
+        constexpr bool Matches[] { Internal::IsSameMember<Member, Members>... };
+        for (std::size_t index {}; index != FieldCount; ++index) {
+            if (Matches[index])
+                return index;
+        }
+        return FieldCount;
+    }();
+
+    static_assert(FieldCount != 0, "ECS::SoAComponentTable: At least one field member is required");
+
+
+    /** @brief Get the number of components inside the table */
+    [[nodiscard]] inline EntityIndex count(void) const noexcept { return _entities.size(); }
+
+    /** @brief Check if an entity exists in the sparse set */
+    [[nodiscard]] inline bool exists(const Entity entity) const noexcept
+        { return getUnstableIndex(entity) != NullEntityIndex; }
+
+
+    /** @brief Add a component into the table, scattered into the field vectors */
+    void add(const Entity entity, const ComponentType &component = ComponentType {}) noexcept;
+
+    /** @brief Try to add a component into the table
+     *  @note If the entity already attached 'ComponentType', the old value is updated */
+    void tryAdd(const Entity entity, const ComponentType &component) noexcept;
+
+    /** @brief Try to update component of an entity through a gather / scatter round-trip
+     *  @note If a component doesn't exists, it is created */
+    template<typename Functor>
+        requires std::is_invocable_v<Functor, ComponentType &>
+    void tryAdd(const Entity entity, Functor &&functor) noexcept;
+
+    /** @brief Add a range of components into the table */
+    void addRange(const EntityRange range, const ComponentType &component = ComponentType {}) noexcept;
+
+
+    /** @brief Remove a component from the table
+     *  @note The entity must be inside table else its an undefined behavior */
+    void remove(const Entity entity) noexcept;
+
+    /** @brief Try to remove a component from the table
+     *  @return True if the component has been removed */
+    bool tryRemove(const Entity entity) noexcept;
+
+    /** @brief Remove a range of components from the table, absent entities are skipped */
+    void removeRange(const EntityRange range) noexcept;
+
+
+    /** @brief Gather an entity's component out of the field vectors */
+    [[nodiscard]] ComponentType get(const Entity entity) const noexcept;
+
+    /** @brief Scatter a component into the field vectors of an entity */
+    void set(const Entity entity, const ComponentType &component) noexcept;
+
+    /** @brief Get a single field of an entity */
+    template<auto Member>
+    [[nodiscard]] inline auto &getField(const Entity entity) noexcept
+        { return std::get<FieldIndex<Member>>(_fields).at(_indexSet.at(entity)); }
+    template<auto Member>
+    [[nodiscard]] inline const auto &getField(const Entity entity) const noexcept
+        { return std::get<FieldIndex<Member>>(_fields).at(_indexSet.at(entity)); }
+
+    /** @brief Get the densely packed vector of a field as a span */
+    template<auto Member>
+    [[nodiscard]] inline auto field(void) noexcept
+        { auto &fields = std::get<FieldIndex<Member>>(_fields); return std::span(fields.data(), fields.size()); }
+    template<auto Member>
+    [[nodiscard]] inline auto field(void) const noexcept
+        { const auto &fields = std::get<FieldIndex<Member>>(_fields); return std::span(fields.data(), fields.size()); }
+
+
+    /** @brief Get the unstable index of an entity (NullEntityIndex if not found) */
+    [[nodiscard]] EntityIndex getUnstableIndex(const Entity entity) const noexcept;
+
+    /** @brief Get registered entity list */
+    [[nodiscard]] inline const auto &entities(void) const noexcept { return _entities; }
+
+
+    /** @brief Traverse table with a callback taking (Entity) as argument
+     *  @note If the callback returns a boolean, traversal is stopped when 'false' is returned */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, kF::ECS::Entity>
+    void traverse(Callback &&callback) noexcept;
+
+    /** @brief Traverse a subset of fields, only streaming the selected vectors
+     *  @note The callback must take (Entity, Fields &...) or (Fields &...) as arguments
+     *  @note If the callback returns a boolean, traversal is stopped when 'false' is returned */
+    template<auto ...Fields, typename Callback>
+    void traverseFields(Callback &&callback) noexcept;
+
+
+    /** @brief Clear the table */
+    void clear(void) noexcept;
+
+    /** @brief Release the table */
+    void release(void) noexcept;
+
+
+    /** @brief Release unused capacity of the dense arrays, keeping the table content intact */
+    void shrinkToFit(void) noexcept;
+
+    /** @brief Get the memory footprint of the table */
+    [[nodiscard]] TableMemoryUsage memoryUsage(void) const noexcept;
+
+private:
+    /** @brief Hiden implementation of add function */
+    void addImpl(const Entity entity, const ComponentType &component) noexcept;
+
+    /** @brief Hiden implementation of remove function */
+    void removeImpl(const Entity entity, const EntityIndex entityIndex) noexcept;
+
+
+    IndexSparseSet _indexSet {};
+    Entities _entities {};
+    FieldsTuple _fields {};
+};
+
+#include "SoAComponentTable.ipp"
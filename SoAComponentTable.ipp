@@ -0,0 +1,264 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SoA component table
+ */
+
+#include <Kube/Core/Abort.hpp>
+
+#include "SoAComponentTable.hpp"
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::add(const Entity entity, const ComponentType &component) noexcept
+{
+    kFAssert(!exists(entity),
+        "ECS::SoAComponentTable::add: Entity '", entity, "' already exists");
+
+    addImpl(entity, component);
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::tryAdd(const Entity entity, const ComponentType &component) noexcept
+{
+    if (const auto entityIndex = getUnstableIndex(entity); entityIndex != NullEntityIndex) [[likely]] {
+        [this, entityIndex, &component]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+            ((std::get<Indexes>(_fields).at(entityIndex) = component.*Members), ...);
+        }(std::make_index_sequence<FieldCount> {});
+    } else
+        addImpl(entity, component);
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+template<typename Functor>
+    requires std::is_invocable_v<Functor, ComponentType &>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::tryAdd(const Entity entity, Functor &&functor) noexcept
+{
+    ComponentType component {};
+    if (exists(entity)) [[likely]]
+        component = get(entity);
+    functor(component);
+    tryAdd(entity, component);
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::addRange(const EntityRange range, const ComponentType &component) noexcept
+{
+    const auto lastIndex = _entities.size();
+    const auto count = range.end - range.begin;
+
+    if constexpr (KUBE_DEBUG_BUILD) {
+        // Ensure no entity exists in range
+        for (const auto entity : _entities) {
+            kFEnsure(entity < range.begin || entity >= range.end,
+                "ECS::SoAComponentTable::addRange: Entity '", entity, "' from entity range [", range.begin, ", ", range.end, "[ already exists");
+        }
+    }
+
+    // Insert entities
+    _entities.insertCustom(_entities.end(), count, [range](const auto count, const auto out) {
+        for (Entity i = 0; i != count; ++i)
+            out[i] = range.begin + i;
+    });
+
+    // Insert indexes
+    for (Entity i = lastIndex, it = range.begin; it != range.end; ++i, ++it) {
+        _indexSet.add(it, i);
+    }
+
+    // Fill every field vector in bulk
+    [this, count, &component]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        const auto fill = [count]<auto Member>(auto &fields, const ComponentType &component) {
+            fields.insertCustom(fields.end(), count, [&component](const auto count, const auto data) {
+                for (EntityIndex index {}; index != count; ++index)
+                    new (data + index) Internal::SoAFieldType<Member>(component.*Member);
+            });
+        };
+        ((fill.template operator()<Members>(std::get<Indexes>(_fields), component)), ...);
+    }(std::make_index_sequence<FieldCount> {});
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::addImpl(const Entity entity, const ComponentType &component) noexcept
+{
+    const auto componentIndex = _entities.size();
+    _indexSet.add(entity, componentIndex);
+    _entities.push(entity);
+    [this, &component]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        ((std::get<Indexes>(_fields).push(component.*Members)), ...);
+    }(std::make_index_sequence<FieldCount> {});
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::remove(const Entity entity) noexcept
+{
+    kFAssert(exists(entity),
+        "ECS::SoAComponentTable::remove: Entity '", entity, "' doesn't exists");
+    removeImpl(entity, _indexSet.extract(entity));
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline bool kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::tryRemove(const Entity entity) noexcept
+{
+    if (const auto entityIndex = getUnstableIndex(entity); entityIndex != NullEntityIndex) [[likely]] {
+        _indexSet.remove(entity);
+        removeImpl(entity, entityIndex);
+        return true;
+    } else
+        return false;
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::removeRange(const EntityRange range) noexcept
+{
+    for (auto it = range.begin; it != range.end; ++it)
+        (void)tryRemove(it);
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::removeImpl([[maybe_unused]] const Entity entity, const EntityIndex entityIndex) noexcept
+{
+    if (_entities.size() != entityIndex + 1) [[likely]] {
+        const auto lastEntity = _entities.back();
+        _indexSet.at(lastEntity) = entityIndex;
+        _entities.at(entityIndex) = lastEntity;
+        [this, entityIndex]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+            ((std::get<Indexes>(_fields).at(entityIndex) = std::move(std::get<Indexes>(_fields).back())), ...);
+        }(std::make_index_sequence<FieldCount> {});
+    }
+    _entities.pop();
+    [this]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        ((std::get<Indexes>(_fields).pop()), ...);
+    }(std::make_index_sequence<FieldCount> {});
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline ComponentType kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::get(const Entity entity) const noexcept
+{
+    const auto entityIndex = _indexSet.at(entity);
+    ComponentType component {};
+
+    [this, entityIndex, &component]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        ((component.*Members = std::get<Indexes>(_fields).at(entityIndex)), ...);
+    }(std::make_index_sequence<FieldCount> {});
+    return component;
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::set(const Entity entity, const ComponentType &component) noexcept
+{
+    const auto entityIndex = _indexSet.at(entity);
+
+    [this, entityIndex, &component]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        ((std::get<Indexes>(_fields).at(entityIndex) = component.*Members), ...);
+    }(std::make_index_sequence<FieldCount> {});
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline kF::ECS::EntityIndex kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::getUnstableIndex(const Entity entity) const noexcept
+{
+    if (_indexSet.pageExists(entity)) [[likely]]
+        return _indexSet.at(entity);
+    else
+        return NullEntityIndex;
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, kF::ECS::Entity>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::traverse(Callback &&callback) noexcept
+{
+    for (EntityIndex index {}, count = _entities.size(); index != count; ++index) {
+        if constexpr (std::is_same_v<std::invoke_result_t<Callback, Entity>, bool>) {
+            if (!callback(_entities.at(index)))
+                break;
+        } else
+            callback(_entities.at(index));
+    }
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+template<auto ...Fields, typename Callback>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::traverseFields(Callback &&callback) noexcept
+{
+    static_assert(sizeof...(Fields) != 0, "ECS::SoAComponentTable::traverseFields: At least one field is required");
+    static_assert(((FieldIndex<Fields> != FieldCount) && ...), "ECS::SoAComponentTable::traverseFields: Every field must be a declared member of the table");
+
+    for (EntityIndex index {}, count = _entities.size(); index != count; ++index) {
+        // Entity & fields
+        if constexpr (std::is_invocable_v<Callback, Entity, Internal::SoAFieldType<Fields> &...>) {
+            if constexpr (std::is_same_v<std::invoke_result_t<Callback, Entity, Internal::SoAFieldType<Fields> &...>, bool>) {
+                if (!callback(_entities.at(index), std::get<FieldIndex<Fields>>(_fields).at(index)...))
+                    break;
+            } else
+                callback(_entities.at(index), std::get<FieldIndex<Fields>>(_fields).at(index)...);
+        // Fields only
+        } else {
+            if constexpr (std::is_same_v<std::invoke_result_t<Callback, Internal::SoAFieldType<Fields> &...>, bool>) {
+                if (!callback(std::get<FieldIndex<Fields>>(_fields).at(index)...))
+                    break;
+            } else
+                callback(std::get<FieldIndex<Fields>>(_fields).at(index)...);
+        }
+    }
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::clear(void) noexcept
+{
+    _indexSet.clearUnsafe();
+    _entities.clear();
+    [this]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        ((std::get<Indexes>(_fields).clear()), ...);
+    }(std::make_index_sequence<FieldCount> {});
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::release(void) noexcept
+{
+    _indexSet.releaseUnsafe();
+    _entities.release();
+    [this]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        ((std::get<Indexes>(_fields).release()), ...);
+    }(std::make_index_sequence<FieldCount> {});
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline void kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::shrinkToFit(void) noexcept
+{
+    // Rebuild a vector into a tightly sized storage
+    const auto shrink = []<typename VectorType>(VectorType &vector) {
+        if (vector.capacity() == vector.size()) [[unlikely]]
+            return;
+        VectorType shrunk;
+        shrunk.reserve(vector.size());
+        shrunk.insertCustom(shrunk.end(), vector.size(), [&vector](const auto count, const auto data) {
+            using Value = std::remove_pointer_t<std::remove_cvref_t<decltype(data)>>;
+            for (auto index = decltype(count) {}; index != count; ++index)
+                new (data + index) Value(std::move(vector.at(index)));
+        });
+        vector = std::move(shrunk);
+    };
+
+    shrink(_entities);
+    [this, &shrink]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        ((shrink(std::get<Indexes>(_fields))), ...);
+    }(std::make_index_sequence<FieldCount> {});
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator, auto ...Members>
+inline kF::ECS::TableMemoryUsage kF::ECS::SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>::memoryUsage(void) const noexcept
+{
+    TableMemoryUsage usage {
+        .usedBytes = _entities.size() * sizeof(Entity),
+        .allocatedBytes = _entities.capacity() * sizeof(Entity)
+    };
+
+    [this, &usage]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        const auto accumulate = [&usage]<typename VectorType>(const VectorType &fields) {
+            using Value = std::remove_cvref_t<decltype(fields.at(0u))>;
+            usage.usedBytes += fields.size() * sizeof(Value);
+            usage.allocatedBytes += fields.capacity() * sizeof(Value);
+        };
+        ((accumulate(std::get<Indexes>(_fields))), ...);
+    }(std::make_index_sequence<FieldCount> {});
+    return usage;
+}
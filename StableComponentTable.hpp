@@ -5,10 +5,18 @@
 
 #pragma once
 
+#include <span>
+
 #include <Kube/Core/SparseSet.hpp>
 
 #include "Base.hpp"
 
+namespace kF::Flow
+{
+    class Graph;
+    class Scheduler;
+}
+
 namespace kF::ECS
 {
     template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
@@ -59,7 +67,16 @@ public:
     static_assert(ComponentPageSize != 0, "ECS::StableComponentTable: Component page size cannot be null");
     static_assert(Core::IsPowerOf2(ComponentPageSize), "ECS::StableComponentTable: Component page size must be a power of 2");
 
-    /** @brief Iterator abstraction */
+    /** @brief Default number of components per parallel traversal task, sized so each chunk covers whole cachelines */
+    static constexpr EntityIndex DefaultParallelGrainSize =
+        static_cast<EntityIndex>((Core::CacheLineSize * 64u + sizeof(ComponentType) - 1u) / sizeof(ComponentType));
+
+    /** @brief Default tombstone percentage above which the table requests compaction */
+    static constexpr EntityIndex DefaultCompactionRatio = 25u;
+
+    /** @brief Iterator abstraction
+     *  @note The current component page data pointer is cached so in-page iteration is plain
+     *  pointer arithmetic, the page indirection is only paid at page boundaries */
     template<typename Type>
     struct IteratorType
     {
@@ -67,9 +84,8 @@ public:
         /** @brief Destructor */
         inline ~IteratorType(void) noexcept = default;
 
-        /** @brief Value constructor */
-        inline IteratorType(StableComponentTable * const table, const EntityIndex index) noexcept
-            : _table(table), _index(index) {}
+        /** @brief Value constructor, normalizes onto the first live slot at or after 'index' */
+        IteratorType(StableComponentTable * const table, const EntityIndex index) noexcept;
 
         /** @brief Copy constructor */
         inline IteratorType(const IteratorType &other) noexcept = default;
@@ -79,10 +95,10 @@ public:
 
 
         /** @brief Dereference iterator */
-        [[nodiscard]] inline Type &operator*(void) const noexcept { return _table->atIndex(_index); }
+        [[nodiscard]] inline Type &operator*(void) const noexcept { return _pageData[GetComponentIndex(_index)]; }
 
         /** @brief Dereference iterator */
-        [[nodiscard]] inline Type &operator->(void) const noexcept { return _table->atIndex(_index); }
+        [[nodiscard]] inline Type *operator->(void) const noexcept { return _pageData + GetComponentIndex(_index); }
 
 
         /** @brief Prefix increment operator */
@@ -105,8 +121,13 @@ public:
             { return _table != other._table || _index != other._index; }
 
     private:
+        /** @brief Refresh the cached page data pointer after an index change */
+        void updatePageCache(void) noexcept;
+
         StableComponentTable *_table {};
         EntityIndex _index {};
+        EntityIndex _pageIndex { NullEntityIndex };
+        Type *_pageData {};
     };
 
     /** @brief Mutable iterator */
@@ -132,6 +153,19 @@ public:
     void pack(void) noexcept;
 
 
+    /** @brief Set the tombstone percentage above which 'needsCompaction' returns true */
+    inline void setCompactionRatio(const EntityIndex tombstonePercent) noexcept { _compactionRatio = tombstonePercent; }
+
+    /** @brief Check if the tombstone ratio reached the compaction threshold */
+    [[nodiscard]] inline bool needsCompaction(void) const noexcept
+        { return !_tombstones.empty() && _tombstones.size() * 100u >= _entities.size() * _compactionRatio; }
+
+    /** @brief Relocate at most 'budget' components into tombstone slots, converging to a dense
+     *  table without a stop-the-world pack (breaks pointer stability of relocated components only)
+     *  @return Number of relocated components, less than 'budget' once the table is dense */
+    EntityIndex compactStep(const EntityIndex budget) noexcept;
+
+
     /** @brief Add a component into the table */
     template<typename ...Args>
     ComponentType &add(const Entity entity, Args &&...args) noexcept;
@@ -149,6 +183,13 @@ public:
     template<typename ...Args>
     void addRange(const EntityRange range, const Args &...args) noexcept;
 
+    /** @brief Add a range of components into the table, each initialized through a functor
+     *  @note Initializer must be invocable as void(EntityIndex, ComponentType &), the index is
+     *  relative to the range begin and the component is default constructed beforehand */
+    template<typename Initializer>
+        requires std::is_invocable_v<Initializer, EntityIndex, ComponentType &>
+    void addRangeCustom(const EntityRange range, Initializer &&initializer) noexcept;
+
 
     /** @brief Remove a component from the table
      *  @note The entity must be inside table else its an undefined behavior (use exists to check if an entity is registered) */
@@ -176,6 +217,16 @@ public:
         { return const_cast<ComponentType &>(std::as_const(*this).get(entity)); }
 
 
+    /** @brief Try to get an entity's component, returns nullptr if the entity is not in the table */
+    [[nodiscard]] inline ComponentType *tryGet(const Entity entity) noexcept
+        { return const_cast<ComponentType *>(std::as_const(*this).tryGet(entity)); }
+    [[nodiscard]] inline const ComponentType *tryGet(const Entity entity) const noexcept
+    {
+        const auto entityIndex = getUnstableIndex(entity);
+        return entityIndex != NullEntityIndex ? &atIndex(entityIndex) : nullptr;
+    }
+
+
     /** @brief Get the unstable index of an entity (NullEntityIndex if not found) */
     [[nodiscard]] EntityIndex getUnstableIndex(const Entity entity) const noexcept;
 
@@ -187,11 +238,11 @@ public:
 
     /** @brief Components begin / end iterators */
     [[nodiscard]] inline auto begin(void) noexcept { return Iterator(this, 0u); }
-    [[nodiscard]] inline auto begin(void) const noexcept { return ConstIterator(this, 0u); }
-    [[nodiscard]] inline auto cbegin(void) const noexcept { return ConstIterator(this, 0u); }
-    [[nodiscard]] inline auto end(void) noexcept { return Iterator(this, count()); }
-    [[nodiscard]] inline auto end(void) const noexcept { return ConstIterator(this, count()); }
-    [[nodiscard]] inline auto cend(void) const noexcept { return ConstIterator(this, count()); }
+    [[nodiscard]] inline auto begin(void) const noexcept { return ConstIterator(const_cast<StableComponentTable *>(this), 0u); }
+    [[nodiscard]] inline auto cbegin(void) const noexcept { return begin(); }
+    [[nodiscard]] inline auto end(void) noexcept { return Iterator(this, _entities.size()); }
+    [[nodiscard]] inline auto end(void) const noexcept { return ConstIterator(const_cast<StableComponentTable *>(this), _entities.size()); }
+    [[nodiscard]] inline auto cend(void) const noexcept { return end(); }
 
     /** @brief Components reverse begin / end iterators */
     [[nodiscard]] inline auto rbegin(void) noexcept { return std::make_reverse_iterator(begin()); }
@@ -211,6 +262,12 @@ public:
     template<typename CompareFunctor>
     void sort(CompareFunctor &&compareFunc) noexcept;
 
+    /** @brief Restore the sort order of a nearly sorted table using an adaptive insertion sort
+     *  @note Packs the table first like 'sort', costs O(n + inversions) afterwards
+     *  @note CompareFunctor must have the following signature: bool(Entity, Entity) */
+    template<typename CompareFunctor>
+    void ensureSorted(CompareFunctor &&compareFunc) noexcept;
+
 
     /** @brief Clear the table */
     void clear(void) noexcept;
@@ -219,6 +276,14 @@ public:
     void release(void) noexcept;
 
 
+    /** @brief Release unused memory without moving live components: trims trailing dead slots,
+     *  frees component pages that only hold tombstones and tightens the dense arrays */
+    void shrinkToFit(void) noexcept;
+
+    /** @brief Get the memory footprint of the table */
+    [[nodiscard]] TableMemoryUsage memoryUsage(void) const noexcept;
+
+
     /** @brief Traverse table with a callback taking (Entity, Component &) as arguments or only (Component &)
      *  @note If the callback returns a boolean, traversal is stopped when 'false' is returned */
     template<typename Callback>
@@ -237,11 +302,74 @@ public:
     inline void traverse(Callback &&callback) const noexcept
         { const_cast<StableComponentTable &>(*this).traverse(std::forward<Callback>(callback)); }
 
+
+    /** @brief Traverse table in parallel by partitioning it into tasks of 'grainSize' components ran on 'scheduler'
+     *  @note The callback has the same signatures as 'traverse' and must be thread safe
+     *  @note If the callback returns a boolean, 'false' only stops the traversal of its own chunk
+     *  @note This function blocks until every task completed: it must not be called from a task
+     *  running on the same scheduler (e.g. a system tick), the blocking wait would starve the
+     *  workers supposed to execute the chunks, use 'recordTraverseParallel' there instead */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, ComponentType &>
+            || std::is_invocable_v<Callback, kF::ECS::Entity>
+            || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
+    void traverseParallel(Flow::Scheduler &scheduler, Callback &&callback, const EntityIndex grainSize = DefaultParallelGrainSize) noexcept;
+
+    /** @brief Record 'taskCount' parallel traversal tasks into 'graph', safe to use from system ticks
+     *  @note Each task computes its slice of the table when the graph executes, so the recorded
+     *  graph stays valid across table mutations and reruns; the callback is copied into every task
+     *  @note The callback has the same signatures as 'traverse' and must be thread safe
+     *  @note If the callback returns a boolean, 'false' only stops the traversal of its own slice */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, ComponentType &>
+            || std::is_invocable_v<Callback, kF::ECS::Entity>
+            || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
+    void recordTraverseParallel(Flow::Graph &graph, const Callback &callback, const EntityIndex taskCount) noexcept;
+
+
+    /** @brief Iterate over component pages as contiguous memory chunks
+     *  @note The callback must take (std::span<const Entity>, std::span<ComponentType>) as arguments
+     *  @note Both spans always reference the same entity slots, tombstones are handed out as NullEntity
+     *  entries whose component slot must be skipped by the caller */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, std::span<const Entity>, std::span<ComponentType>>
+    void forEachChunk(Callback &&callback) noexcept;
+
+    /** @brief Iterate over component pages as contiguous memory chunks (const version) */
+    template<typename Callback>
+        requires std::is_invocable_v<Callback, std::span<const Entity>, std::span<const ComponentType>>
+    void forEachChunk(Callback &&callback) const noexcept;
+
+
+    /** @brief Serialize the table into a binary snapshot, tombstones are skipped so the snapshot is packed
+     *  @note Only available for trivially copyable components
+     *  @note Writer must be invocable as void(const void *data, std::size_t bytes) */
+    template<typename Writer>
+        requires std::is_invocable_v<Writer, const void *, std::size_t>
+    void serialize(Writer &&writer) const noexcept;
+
+    /** @brief Reconstruct the table from a binary snapshot, clearing its previous content
+     *  @note The loaded table is packed, pointer stability starts over from the snapshot layout
+     *  @note Only available for trivially copyable components
+     *  @note Reader must be invocable as void(void *data, std::size_t bytes) */
+    template<typename Reader>
+        requires std::is_invocable_v<Reader, void *, std::size_t>
+    void deserialize(Reader &&reader) noexcept;
+
 private:
     /** @brief Check if an entity exists in the sparse set */
     [[nodiscard]] EntityIndex findIndex(const Entity entity) const noexcept;
 
 
+    /** @brief Hiden implementation of traverse function over slot range [from, to[ */
+    template<typename Callback>
+    void traverseRange(const EntityIndex from, const EntityIndex to, Callback &&callback) noexcept;
+
+
+    /** @brief Reorder components & sparse set after the entity list got sorted */
+    void applySortPatch(void) noexcept;
+
+
     /** @brief Hiden implementation of add function */
     template<typename ...Args>
     ComponentType &addImpl(const Entity entity, Args &&...args) noexcept;
@@ -263,6 +391,9 @@ private:
     [[nodiscard]] bool pageExists(const EntityIndex pageIndex) const noexcept
         { return pageIndex < _componentPages.size(); }
 
+    /** @brief Get a page at index, creating it or reviving it if freed by shrinkToFit */
+    [[nodiscard]] ComponentPage *ensurePage(const EntityIndex pageIndex) noexcept;
+
 
     /** @brief Get page index from an entity index */
     [[nodiscard]] static constexpr EntityIndex GetPageIndex(const EntityIndex unstableIndex) noexcept
@@ -277,6 +408,7 @@ private:
     Entities _entities {};
     EntityIndexes _tombstones {};
     ComponentPages _componentPages {};
+    EntityIndex _compactionRatio { DefaultCompactionRatio };
 };
 
 #include "StableComponentTable.ipp"
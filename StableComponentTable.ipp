@@ -4,24 +4,37 @@
  */
 
 #include <Kube/Core/SmallVector.hpp>
+#include <Kube/Flow/Graph.hpp>
+#include <Kube/Flow/Scheduler.hpp>
 
 #include "StableComponentTable.hpp"
 
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type>
+inline kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::IteratorType<Type>::IteratorType(
+        StableComponentTable * const table, const EntityIndex index) noexcept
+    : _table(table), _index(index)
+{
+    const auto &entities = _table->_entities;
+    const auto max = entities.size();
+
+    while (_index < max && entities.at(_index) == NullEntity)
+        ++_index;
+    updatePageCache();
+}
+
 template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
 template<typename Type>
 inline kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::IteratorType<Type> &
     kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::IteratorType<Type>::operator++(void) noexcept
 {
-    const auto &entities = _table->entities();
+    const auto &entities = _table->_entities;
     const auto max = entities.size();
 
-    while (true) {
-        if (_index == max)
-            break;
+    do {
         ++_index;
-        if (entities.at(_index) != NullEntityIndex)
-            break;
-    }
+    } while (_index < max && entities.at(_index) == NullEntity);
+    updatePageCache();
     return *this;
 }
 
@@ -30,19 +43,31 @@ template<typename Type>
 inline kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::IteratorType<Type> &
     kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::IteratorType<Type>::operator--(void) noexcept
 {
-    const auto &entities = _table->entities();
-    const auto max = entities.size();
+    const auto &entities = _table->_entities;
 
-    while (true) {
-        if (_index == 0u)
-            break;
+    // Clamp at the first slot so decrementing a begin iterator cannot wrap around
+    while (_index) {
         --_index;
-        if (entities.at(_index) != NullEntityIndex)
+        if (entities.at(_index) != NullEntity)
             break;
     }
+    updatePageCache();
     return *this;
 }
 
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Type>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::IteratorType<Type>::updatePageCache(void) noexcept
+{
+    // Past the end iterators keep their last cached page, it is never dereferenced
+    if (_index >= _table->_entities.size()) [[unlikely]]
+        return;
+    if (const auto pageIndex = GetPageIndex(_index); pageIndex != _pageIndex) {
+        _pageIndex = pageIndex;
+        _pageData = _table->_componentPages.at(pageIndex)->data();
+    }
+}
+
 template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
 inline kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::~StableComponentTable(void) noexcept
 {
@@ -78,6 +103,46 @@ inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, Enti
     _entities.erase(_entities.begin() + last, _entities.end());
 }
 
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::ECS::EntityIndex kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::compactStep(const EntityIndex budget) noexcept
+{
+    EntityIndex relocated {};
+
+    while (relocated != budget) {
+        // Drop trailing tombstone slots, their tombstone entries become stale
+        auto last = _entities.size();
+        while (last && _entities.at(last - 1u) == NullEntity)
+            --last;
+        _entities.erase(_entities.begin() + last, _entities.end());
+        if (_tombstones.empty())
+            break;
+        const auto slot = _tombstones.back();
+        _tombstones.pop();
+        // Skip tombstone entries staled by trailing trims
+        if (slot >= _entities.size())
+            continue;
+        // Relocate the last live component into the tombstone slot
+        const auto lastIndex = _entities.size() - 1u;
+        auto &component = atIndex(lastIndex);
+        insertComponent(slot, std::move(component));
+        if constexpr (!std::is_trivially_destructible_v<ComponentType>)
+            component.~ComponentType();
+        const auto entity = _entities.at(lastIndex);
+        _entities.at(slot) = entity;
+        _indexSet.at(entity) = slot;
+        _entities.pop();
+        ++relocated;
+    }
+
+    // Purge tombstone entries staled by trailing trims so table invariants hold
+    const auto size = _entities.size();
+    _tombstones.erase(
+        std::remove_if(_tombstones.begin(), _tombstones.end(), [size](const EntityIndex slot) { return slot >= size; }),
+        _tombstones.end()
+    );
+    return relocated;
+}
+
 template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
 template<typename ...Args>
 inline ComponentType &kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::add(const Entity entity, Args &&...args) noexcept
@@ -116,8 +181,8 @@ template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS
 template<typename ...Args>
 inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::addRange(const EntityRange range, const Args &...args) noexcept
 {
-    const auto lastIndex = _entities.size();
     const auto count = range.end - range.begin;
+    auto it = range.begin;
 
     if constexpr (KUBE_DEBUG_BUILD) {
         // Ensure no entity exists in range
@@ -127,20 +192,102 @@ inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, Enti
         }
     }
 
-    // Insert entities
-    _entities.insertCustom(_entities.end(), count, [range](const auto count, const auto out) {
+    // Consume tombstone slots in sorted runs first
+    if (!_tombstones.empty()) [[unlikely]] {
+        std::sort(_tombstones.begin(), _tombstones.end());
+        const auto consumed = std::min<EntityIndex>(_tombstones.size(), count);
+        for (EntityIndex tombstoneIndex {}; tombstoneIndex != consumed; ++tombstoneIndex, ++it) {
+            const auto slot = _tombstones.at(tombstoneIndex);
+            _entities.at(slot) = it;
+            _indexSet.add(it, slot);
+            insertComponent(slot, args...);
+        }
+        _tombstones.erase(_tombstones.begin(), _tombstones.begin() + consumed);
+    }
+    if (it == range.end)
+        return;
+
+    // Append remaining entities in bulk
+    const auto lastIndex = _entities.size();
+    const auto remaining = range.end - it;
+    _entities.insertCustom(_entities.end(), remaining, [it](const auto count, const auto out) {
+        for (EntityIndex i = 0; i != count; ++i)
+            out[i] = it + i;
+    });
+
+    // Insert indexes
+    for (EntityIndex i = lastIndex, entity = it; entity != range.end; ++i, ++entity) {
+        _indexSet.add(entity, i);
+    }
+
+    // Allocate every needed page up front then fill whole pages with tight construction loops
+    const auto endIndex = lastIndex + remaining;
+    for (auto index = lastIndex; index != endIndex;) {
+        const auto componentIndex = GetComponentIndex(index);
+        const auto chunk = std::min<EntityIndex>(ComponentPageSize - componentIndex, endIndex - index);
+        const auto data = ensurePage(GetPageIndex(index))->data() + componentIndex;
+        for (EntityIndex i {}; i != chunk; ++i)
+            new (data + i) ComponentType(args...);
+        index += chunk;
+    }
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Initializer>
+    requires std::is_invocable_v<Initializer, kF::ECS::EntityIndex, ComponentType &>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::addRangeCustom(const EntityRange range, Initializer &&initializer) noexcept
+{
+    const auto count = range.end - range.begin;
+    auto it = range.begin;
+
+    if constexpr (KUBE_DEBUG_BUILD) {
+        // Ensure no entity exists in range
+        for (const auto entity : _entities) {
+            kFEnsure(entity < range.begin || entity >= range.end,
+                "ECS::StableComponentTable::addRangeCustom: Entity '", entity, "' from entity range [", range.begin, ", ", range.end, "[ already exists");
+        }
+    }
+
+    // Consume tombstone slots in sorted runs first
+    if (!_tombstones.empty()) [[unlikely]] {
+        std::sort(_tombstones.begin(), _tombstones.end());
+        const auto consumed = std::min<EntityIndex>(_tombstones.size(), count);
+        for (EntityIndex tombstoneIndex {}; tombstoneIndex != consumed; ++tombstoneIndex, ++it) {
+            const auto slot = _tombstones.at(tombstoneIndex);
+            _entities.at(slot) = it;
+            _indexSet.add(it, slot);
+            initializer(it - range.begin, insertComponent(slot));
+        }
+        _tombstones.erase(_tombstones.begin(), _tombstones.begin() + consumed);
+    }
+    if (it == range.end)
+        return;
+
+    // Append remaining entities in bulk
+    const auto lastIndex = _entities.size();
+    const auto remaining = range.end - it;
+    _entities.insertCustom(_entities.end(), remaining, [it](const auto count, const auto out) {
         for (EntityIndex i = 0; i != count; ++i)
-            out[i] = range.begin + i;
+            out[i] = it + i;
     });
 
     // Insert indexes
-    for (EntityIndex i = lastIndex, it = range.begin; it != range.end; ++i, ++it) {
-        _indexSet.add(it, i);
+    for (EntityIndex i = lastIndex, entity = it; entity != range.end; ++i, ++entity) {
+        _indexSet.add(entity, i);
     }
 
-    // Insert components
-    for (EntityIndex i = lastIndex, it = range.begin; it != range.end; ++i, ++it) {
-        insertComponent(i, args...);
+    // Allocate every needed page up front then fill whole pages with tight construction loops
+    const auto endIndex = lastIndex + remaining;
+    auto rangeIndex = it - range.begin;
+    for (auto index = lastIndex; index != endIndex;) {
+        const auto componentIndex = GetComponentIndex(index);
+        const auto chunk = std::min<EntityIndex>(ComponentPageSize - componentIndex, endIndex - index);
+        const auto data = ensurePage(GetPageIndex(index))->data() + componentIndex;
+        for (EntityIndex i {}; i != chunk; ++i, ++rangeIndex) {
+            new (data + i) ComponentType();
+            initializer(rangeIndex, data[i]);
+        }
+        index += chunk;
     }
 }
 
@@ -167,14 +314,20 @@ template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS
 template<typename ...Args>
 inline ComponentType &kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::insertComponent(const EntityIndex entityIndex, Args &&...args) noexcept
 {
-    const auto pageIndex = GetPageIndex(entityIndex);
-    const auto componentIndex = GetComponentIndex(entityIndex);
+    // Construct component inside its destination page
+    return *new (ensurePage(GetPageIndex(entityIndex))->data() + GetComponentIndex(entityIndex)) ComponentType(std::forward<Args>(args)...);
+}
 
-    // Ensure destination page exists
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::ComponentPage *
+    kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::ensurePage(const EntityIndex pageIndex) noexcept
+{
     while (!pageExists(pageIndex)) [[unlikely]]
-        _componentPages.push(ComponentPagePtr::Make());
-    // Construct component
-    return *new (_componentPages.at(pageIndex)->data() + componentIndex) ComponentType(std::forward<Args>(args)...);
+        _componentPages.push(ComponentPagePtr());
+    auto &page = _componentPages.at(pageIndex);
+    if (!page) [[unlikely]]
+        page = ComponentPagePtr::Make();
+    return page.get();
 }
 
 template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
@@ -198,8 +351,22 @@ inline bool kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, Enti
 template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
 inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::removeRange(const EntityRange range) noexcept
 {
-    for (auto it = range.begin; it != range.end; ++it)
-        removeImpl(it, _indexSet.at(it));
+    for (auto it = range.begin; it != range.end; ++it) {
+        if (const auto entityIndex = getUnstableIndex(it); entityIndex != NullEntityIndex) [[likely]]
+            removeImpl(it, entityIndex);
+    }
+
+    // Trim trailing dead slots, they need no tombstones
+    auto last = _entities.size();
+    while (last && _entities.at(last - 1u) == NullEntity)
+        --last;
+    if (last != _entities.size()) [[unlikely]] {
+        _entities.erase(_entities.begin() + last, _entities.end());
+        _tombstones.erase(
+            std::remove_if(_tombstones.begin(), _tombstones.end(), [last](const EntityIndex slot) { return slot >= last; }),
+            _tombstones.end()
+        );
+    }
 }
 
 template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
@@ -258,6 +425,7 @@ inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, Enti
 {
     destroyComponents();
     _entities.clear();
+    _tombstones.clear();
     _indexSet.clearUnsafe();
 }
 
@@ -267,9 +435,78 @@ inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, Enti
     destroyComponents();
     _componentPages.release();
     _entities.release();
+    _tombstones.release();
     _indexSet.releaseUnsafe();
 }
 
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::shrinkToFit(void) noexcept
+{
+    // Trim trailing dead slots and their stale tombstones
+    auto last = _entities.size();
+    while (last && _entities.at(last - 1u) == NullEntity)
+        --last;
+    if (last != _entities.size()) [[likely]] {
+        _entities.erase(_entities.begin() + last, _entities.end());
+        _tombstones.erase(
+            std::remove_if(_tombstones.begin(), _tombstones.end(), [last](const EntityIndex slot) { return slot >= last; }),
+            _tombstones.end()
+        );
+    }
+
+    // Free pages whose every slot is dead, they are revived on demand by ensurePage
+    for (EntityIndex pageIndex {}; pageIndex != _componentPages.size(); ++pageIndex) {
+        const auto begin = pageIndex * ComponentPageSize;
+        if (begin >= last)
+            break;
+        const auto end = std::min<EntityIndex>(begin + ComponentPageSize, last);
+        bool live = false;
+        for (auto slot = begin; !live && slot != end; ++slot)
+            live = _entities.at(slot) != NullEntity;
+        if (!live) [[unlikely]]
+            _componentPages.at(pageIndex) = ComponentPagePtr();
+    }
+    // Drop page slots entirely past the live range
+    while (!_componentPages.empty() && (_componentPages.size() - 1u) * ComponentPageSize >= last)
+        _componentPages.pop();
+
+    // Tighten the dense arrays
+    const auto shrink = []<typename VectorType>(VectorType &vector) {
+        if (vector.capacity() == vector.size()) [[unlikely]]
+            return;
+        VectorType shrunk;
+        shrunk.reserve(vector.size());
+        shrunk.insertCustom(shrunk.end(), vector.size(), [&vector](const auto count, const auto data) {
+            using Value = std::remove_pointer_t<std::remove_cvref_t<decltype(data)>>;
+            for (auto index = decltype(count) {}; index != count; ++index)
+                new (data + index) Value(std::move(vector.at(index)));
+        });
+        vector = std::move(shrunk);
+    };
+    shrink(_entities);
+    shrink(_tombstones);
+    shrink(_componentPages);
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+inline kF::ECS::TableMemoryUsage kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::memoryUsage(void) const noexcept
+{
+    TableMemoryUsage usage {
+        .usedBytes = _entities.size() * sizeof(Entity)
+            + _tombstones.size() * sizeof(EntityIndex)
+            + count() * sizeof(ComponentType),
+        .allocatedBytes = _entities.capacity() * sizeof(Entity)
+            + _tombstones.capacity() * sizeof(EntityIndex)
+            + _componentPages.capacity() * sizeof(ComponentPagePtr)
+    };
+
+    for (const auto &page : _componentPages) {
+        if (page)
+            usage.allocatedBytes += sizeof(ComponentPage);
+    }
+    return usage;
+}
+
 template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
 inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::destroyComponents(void) noexcept
 {
@@ -302,6 +539,33 @@ inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, Enti
     // Sort entities
     std::sort(_entities.begin(), _entities.end(), std::forward<CompareFunctor>(compareFunc));
 
+    applySortPatch();
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename CompareFunctor>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::ensureSorted(CompareFunctor &&compareFunc) noexcept
+{
+    // Pack before sorting
+    pack();
+
+    // Adaptive insertion sort of the entity list, linear when the table is already sorted
+    for (EntityIndex index = 1u, count = _entities.size(); index < count; ++index) {
+        const auto entity = _entities.at(index);
+        auto hole = index;
+        while (hole && compareFunc(entity, _entities.at(hole - 1u))) {
+            _entities.at(hole) = _entities.at(hole - 1u);
+            --hole;
+        }
+        _entities.at(hole) = entity;
+    }
+
+    applySortPatch();
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::applySortPatch(void) noexcept
+{
     // Apply sort patch to components & sparse set
     for (EntityIndex from {}, to = _entities.size(); from != to; ++from) {
         auto current = from;
@@ -316,6 +580,76 @@ inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, Enti
     }
 }
 
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Writer>
+    requires std::is_invocable_v<Writer, const void *, std::size_t>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::serialize(Writer &&writer) const noexcept
+{
+    static_assert(std::is_trivially_copyable_v<ComponentType>,
+        "ECS::StableComponentTable::serialize: Component must be trivially copyable");
+
+    const auto total = _entities.size();
+    const TableSnapshotHeader header { .magic = TableSnapshotMagic, .count = count() };
+    writer(&header, sizeof(header));
+
+    // Stream live entity runs
+    for (EntityIndex index {}; index != total;) {
+        if (_entities.at(index) == NullEntity) {
+            ++index;
+            continue;
+        }
+        auto runEnd = index + 1u;
+        while (runEnd != total && _entities.at(runEnd) != NullEntity)
+            ++runEnd;
+        writer(_entities.data() + index, (runEnd - index) * sizeof(Entity));
+        index = runEnd;
+    }
+
+    // Stream live component runs, additionally split at page boundaries
+    for (EntityIndex index {}; index != total;) {
+        if (_entities.at(index) == NullEntity) {
+            ++index;
+            continue;
+        }
+        auto runEnd = index + 1u;
+        while (runEnd != total && _entities.at(runEnd) != NullEntity && GetPageIndex(runEnd) == GetPageIndex(index))
+            ++runEnd;
+        writer(&atIndex(index), (runEnd - index) * sizeof(ComponentType));
+        index = runEnd;
+    }
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Reader>
+    requires std::is_invocable_v<Reader, void *, std::size_t>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::deserialize(Reader &&reader) noexcept
+{
+    static_assert(std::is_trivially_copyable_v<ComponentType>,
+        "ECS::StableComponentTable::deserialize: Component must be trivially copyable");
+
+    clear();
+    TableSnapshotHeader header;
+    reader(&header, sizeof(header));
+    kFEnsure(header.magic == TableSnapshotMagic,
+        "ECS::StableComponentTable::deserialize: Invalid snapshot header");
+    const auto count = header.count;
+    if (!count) [[unlikely]]
+        return;
+
+    // Bulk load the packed entity list
+    _entities.insertCustom(_entities.end(), count, [&reader](const auto count, const auto out) {
+        reader(out, count * sizeof(Entity));
+    });
+
+    // Bulk load components page by page
+    for (EntityIndex index {}; index != count; index += ComponentPageSize)
+        reader(ensurePage(GetPageIndex(index))->data(), std::min<EntityIndex>(ComponentPageSize, count - index) * sizeof(ComponentType));
+
+    // Rebuild the index sparse set
+    for (EntityIndex index {}; index != count; ++index)
+        _indexSet.add(_entities.at(index), index);
+}
+
 template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
 template<typename Callback>
     requires std::is_invocable_v<Callback, ComponentType &>
@@ -323,7 +657,106 @@ template<typename Callback>
         || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
 inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::traverse(Callback &&callback) noexcept
 {
-    for (EntityIndex index {}; index < _entities.size(); ++index) {
+    traverseRange(0u, _entities.size(), std::forward<Callback>(callback));
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, ComponentType &>
+        || std::is_invocable_v<Callback, kF::ECS::Entity>
+        || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::traverseParallel(
+        Flow::Scheduler &scheduler, Callback &&callback, const EntityIndex grainSize) noexcept
+{
+    kFAssert(grainSize != 0,
+        "ECS::StableComponentTable::traverseParallel: Grain size cannot be null");
+
+    const auto count = _entities.size();
+
+    // Small tables are not worth task scheduling overhead
+    if (count <= grainSize) [[unlikely]] {
+        traverseRange(0u, count, callback);
+        return;
+    }
+
+    // Record one task per chunk then block until every chunk completed
+    Flow::Graph graph;
+    for (EntityIndex from {}; from < count; from += grainSize) {
+        const auto to = std::min(from + grainSize, count);
+        graph.add([this, &callback, from, to] { traverseRange(from, to, callback); });
+    }
+    scheduler.schedule(graph);
+    graph.waitSpin();
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, ComponentType &>
+        || std::is_invocable_v<Callback, kF::ECS::Entity>
+        || std::is_invocable_v<Callback, kF::ECS::Entity, ComponentType &>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::recordTraverseParallel(
+        Flow::Graph &graph, const Callback &callback, const EntityIndex taskCount) noexcept
+{
+    kFAssert(taskCount != 0,
+        "ECS::StableComponentTable::recordTraverseParallel: Task count cannot be null");
+
+    for (EntityIndex taskIndex {}; taskIndex != taskCount; ++taskIndex) {
+        graph.add([this, callback, taskIndex, taskCount](void) mutable {
+            // Compute the slice at execution time so the recorded graph follows table mutations
+            const auto count = static_cast<std::size_t>(_entities.size());
+            const auto from = static_cast<EntityIndex>(count * taskIndex / taskCount);
+            const auto to = static_cast<EntityIndex>(count * (taskIndex + 1u) / taskCount);
+            traverseRange(from, to, callback);
+        });
+    }
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, std::span<const kF::ECS::Entity>, std::span<ComponentType>>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::forEachChunk(Callback &&callback) noexcept
+{
+    const auto count = _entities.size();
+
+    for (EntityIndex from {}; from < count; from += ComponentPageSize) {
+        // Pages freed by shrinkToFit only hold tombstones, nothing to hand out
+        const auto &page = _componentPages.at(GetPageIndex(from));
+        if (!page) [[unlikely]]
+            continue;
+        const auto chunkSize = std::min<EntityIndex>(ComponentPageSize, count - from);
+        callback(
+            std::span<const Entity>(_entities.data() + from, chunkSize),
+            std::span<ComponentType>(page->data(), chunkSize)
+        );
+    }
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Callback>
+    requires std::is_invocable_v<Callback, std::span<const kF::ECS::Entity>, std::span<const ComponentType>>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::forEachChunk(Callback &&callback) const noexcept
+{
+    const auto count = _entities.size();
+
+    for (EntityIndex from {}; from < count; from += ComponentPageSize) {
+        // Pages freed by shrinkToFit only hold tombstones, nothing to hand out
+        const auto &page = _componentPages.at(GetPageIndex(from));
+        if (!page) [[unlikely]]
+            continue;
+        const auto chunkSize = std::min<EntityIndex>(ComponentPageSize, count - from);
+        callback(
+            std::span<const Entity>(_entities.data() + from, chunkSize),
+            std::span<const ComponentType>(page->data(), chunkSize)
+        );
+    }
+}
+
+template<typename ComponentType, kF::ECS::EntityIndex ComponentPageSize, kF::ECS::EntityIndex EntityPageSize, kF::Core::StaticAllocatorRequirements Allocator>
+template<typename Callback>
+inline void kF::ECS::StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>::traverseRange(
+        const EntityIndex from, const EntityIndex to, Callback &&callback) noexcept
+{
+    for (EntityIndex index = from; index < to; ++index) {
         const auto entity = _entities[index];
         if (entity == NullEntity) [[unlikely]]
             continue;
@@ -0,0 +1,66 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Static system chain
+ */
+
+#pragma once
+
+#include "System.hpp"
+
+namespace kF::ECS
+{
+    template<kF::Core::FixedString Literal, typename ...SystemTypes>
+    class StaticSystemChain;
+
+    namespace Internal
+    {
+        /** @brief Extract the first system of a chain */
+        template<typename FirstSystem, typename ...SystemTypes>
+        using ChainFrontSystem = FirstSystem;
+    }
+}
+
+/** @brief Composite system fusing a fixed set of systems known at compile time
+ *  @tparam Literal Name of the chain
+ *  @tparam SystemTypes Fused systems, all belonging to the same pipeline, ticked in declaration order
+ *  @note The chain registers as a single system: one tick task directly calls every child tick
+ *  without virtual dispatch and one graph task runs the child graphs chained sequentially, instead
+ *  of two tasks per system. Child graphs always execute when the chain executes, a child tick
+ *  returning false cannot skip its own graph
+ *  @note Children must be default constructible, they are reachable through 'get' */
+template<kF::Core::FixedString Literal, typename ...SystemTypes>
+class kF::ECS::StaticSystemChain
+    : public kF::ECS::System<Literal, typename Internal::ChainFrontSystem<SystemTypes...>::ExecutorPipeline>
+{
+public:
+    /** @brief Shared pipeline of every fused system */
+    using ChainPipeline = typename Internal::ChainFrontSystem<SystemTypes...>::ExecutorPipeline;
+
+    static_assert(sizeof...(SystemTypes) != 0, "ECS::StaticSystemChain: A chain requires at least one system");
+    static_assert((std::is_same_v<typename SystemTypes::ExecutorPipeline, ChainPipeline> && ...),
+        "ECS::StaticSystemChain: Every fused system must belong to the same pipeline");
+
+
+    /** @brief Virtual destructor */
+    virtual ~StaticSystemChain(void) noexcept override = default;
+
+    /** @brief Default constructor, chains every child graph inside the composite task graph */
+    StaticSystemChain(void) noexcept;
+
+
+    /** @brief Tick every fused system with direct calls, in declaration order
+     *  @return True if any fused system requested its graph */
+    [[nodiscard]] bool tick(void) noexcept override;
+
+
+    /** @brief Get a fused system by type */
+    template<typename Child>
+    [[nodiscard]] inline Child &get(void) noexcept { return std::get<Child>(_systems); }
+    template<typename Child>
+    [[nodiscard]] inline const Child &get(void) const noexcept { return std::get<Child>(_systems); }
+
+private:
+    std::tuple<SystemTypes...> _systems {};
+};
+
+#include "StaticSystemChain.ipp"
@@ -0,0 +1,32 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Static system chain
+ */
+
+#include "StaticSystemChain.hpp"
+
+template<kF::Core::FixedString Literal, typename ...SystemTypes>
+inline kF::ECS::StaticSystemChain<Literal, SystemTypes...>::StaticSystemChain(void) noexcept
+{
+    // Record every child graph as a sequential chain inside the composite task graph
+    auto &graph = this->taskGraph();
+    Flow::Task *previous = nullptr;
+    const auto link = [&graph, &previous](auto &child) {
+        auto &task = graph.add(&child.taskGraph());
+        if (previous) [[likely]]
+            task.after(*previous);
+        previous = &task;
+    };
+    std::apply([&link](auto &...children) { (link(children), ...); }, _systems);
+}
+
+template<kF::Core::FixedString Literal, typename ...SystemTypes>
+inline bool kF::ECS::StaticSystemChain<Literal, SystemTypes...>::tick(void) noexcept
+{
+    // Qualified calls bypass the virtual dispatch of every child tick
+    return [this]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        bool scheduleGraph = false;
+        ((scheduleGraph = std::get<Indexes>(_systems).SystemTypes::tick() || scheduleGraph), ...);
+        return scheduleGraph;
+    }(std::make_index_sequence<sizeof...(SystemTypes)> {});
+}
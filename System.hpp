@@ -5,12 +5,17 @@
 
 #pragma once
 
+#include <array>
+
 #include <Kube/Core/TupleUtils.hpp>
 
 #include "ASystem.hpp"
 #include "Pipeline.hpp"
 #include "ComponentTable.hpp"
 #include "StableComponentTable.hpp"
+#include "ComponentGroup.hpp"
+#include "EntityRangeBatch.hpp"
+#include "SoAComponentTable.hpp"
 
 namespace kF::ECS
 {
@@ -27,6 +32,36 @@ namespace kF::ECS
         static constexpr auto PageSize = ComponentPageSize;
     };
 
+    /** @brief Component structure-of-arrays tag (use SoAComponentTable)
+     *  @note Each listed field member lives in its own densely packed vector so kernels touching a
+     *  subset of fields only stream useful data, see SoAComponentTable for the access surface */
+    template<typename ComponentType, auto ...Members>
+    struct SoAComponent
+    {
+        /** @brief Underyling type */
+        using ValueType = ComponentType;
+    };
+
+    /** @brief Component change tracking tag (use a version stamped ComponentTable)
+     *  @note Tracked tables stamp components on insertion, update and mutable get so systems can
+     *  react to modifications through ComponentTable::traverseChanged */
+    template<typename ComponentType>
+    struct TrackedComponent
+    {
+        /** @brief Underyling type */
+        using ValueType = ComponentType;
+    };
+
+    /** @brief Component read-only access tag
+     *  @note Only affects pipeline graph scheduling: the component is stored as usual but the system
+     *  declares it never writes it, allowing concurrent execution with other readers */
+    template<typename ComponentType>
+    struct Read
+    {
+        /** @brief Underyling type */
+        using ValueType = ComponentType;
+    };
+
     namespace Internal
     {
         /** @brief Forward component base */
@@ -44,6 +79,27 @@ namespace kF::ECS
         template<typename ComponentType, EntityIndex ComponentPageSize>
         struct ForwardComponent<StableComponent<ComponentType, ComponentPageSize>> : ForwardComponent<ComponentType> {};
 
+        /** @brief Forward component read-only tag*/
+        template<typename ComponentType>
+        struct ForwardComponent<Read<ComponentType>> : ForwardComponent<ComponentType> {};
+
+        /** @brief Forward component tracked tag*/
+        template<typename ComponentType>
+        struct ForwardComponent<TrackedComponent<ComponentType>> : ForwardComponent<ComponentType> {};
+
+        /** @brief Forward component SoA tag*/
+        template<typename ComponentType, auto ...Members>
+        struct ForwardComponent<SoAComponent<ComponentType, Members...>> : ForwardComponent<ComponentType> {};
+
+
+        /** @brief Component read-only access detector */
+        template<typename ComponentType>
+        struct IsReadOnlyComponent : std::false_type {};
+
+        /** @brief Component read-only access detector, read-only tag case */
+        template<typename ComponentType>
+        struct IsReadOnlyComponent<Read<ComponentType>> : std::true_type {};
+
 
         /** @brief Forward table base */
         template<typename ComponentType, EntityIndex EntityPageSize, typename Allocator>
@@ -63,6 +119,25 @@ namespace kF::ECS
             using Type = StableComponentTable<ComponentType, ComponentPageSize, EntityPageSize, Allocator>;
         };
 
+        /** @brief Forward table read-only tag*/
+        template<typename ComponentType, EntityIndex EntityPageSize, typename Allocator>
+        struct ForwardComponentTable<Read<ComponentType>, EntityPageSize, Allocator>
+            : ForwardComponentTable<ComponentType, EntityPageSize, Allocator> {};
+
+        /** @brief Forward table tracked tag*/
+        template<typename ComponentType, EntityIndex EntityPageSize, typename Allocator>
+        struct ForwardComponentTable<TrackedComponent<ComponentType>, EntityPageSize, Allocator>
+        {
+            using Type = ComponentTable<ComponentType, EntityPageSize, Allocator, true>;
+        };
+
+        /** @brief Forward table SoA tag*/
+        template<typename ComponentType, EntityIndex EntityPageSize, typename Allocator, auto ...Members>
+        struct ForwardComponentTable<SoAComponent<ComponentType, Members...>, EntityPageSize, Allocator>
+        {
+            using Type = SoAComponentTable<ComponentType, EntityPageSize, Allocator, Members...>;
+        };
+
 
         /** @brief Tuple of forwarded components */
         template<typename ...ComponentTypes>
@@ -109,6 +184,14 @@ public:
     /** @brief Number of component tables in this system */
     static constexpr std::size_t ComponentCount = sizeof...(ComponentTypes);
 
+    /** @brief Declared component accesses of the system */
+    static constexpr std::array<ComponentAccess, ComponentCount> ComponentAccesses {
+        ComponentAccess {
+            .typeId = GetComponentTypeId<typename Internal::ForwardComponent<ComponentTypes>::Type>(),
+            .readOnly = Internal::IsReadOnlyComponent<ComponentTypes>::value
+        }...
+    };
+
 
     /** @brief Virtual destructor */
     virtual ~System(void) noexcept override = default;
@@ -123,6 +206,9 @@ public:
     /** @brief Virtual system name getter */
     [[nodiscard]] constexpr std::string_view systemName(void) const noexcept final { return Name; }
 
+    /** @brief Virtual declared component access list getter */
+    [[nodiscard]] constexpr std::span<const ComponentAccess> componentAccesses(void) const noexcept final { return ComponentAccesses; }
+
 
     /** @brief Interact with another system using 'this'
      *  @note The callback functor must have a system reference as argument : void(auto &system)
@@ -138,6 +224,15 @@ public:
     void interact(Callback &&callback) const noexcept;
 
 
+    /** @brief Deliver a batch of structural change notifications to a pipeline as one event
+     *  @note The batch is coalesced and consumed, the callback is invoked on the destination
+     *  pipeline with (std::span<const EntityRange>)
+     *  @tparam DestinationPipeline Pipeline to which belong the callback */
+    template<typename DestinationPipeline, bool RetryOnFailure = true, typename Callback>
+        requires std::is_invocable_v<Callback, std::span<const kF::ECS::EntityRange>>
+    void notifyRanges(EntityRangeBatch &batch, Callback &&callback) const noexcept;
+
+
     /** @brief Pack stable component tables */
     template<typename ...Components>
         requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
@@ -166,6 +261,12 @@ public:
         requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
     EntityRange addRange(const Entity count, Components &&...components) noexcept;
 
+    /** @brief Creates a range of entities with per entity component data, one reserve per table
+     *  @note Each initializer must be invocable as void(EntityIndex, Component &), the index is
+     *  relative to the returned range begin and the component is default constructed beforehand */
+    template<typename ...Initializers>
+    EntityRange addRangeCustom(const Entity count, Initializers &&...initializers) noexcept;
+
 
     /** @brief Attach components to an entity */
     template<typename ...Components>
@@ -254,14 +355,65 @@ public:
     /** @brief Calls a functor for each component table */
     template<typename Functor>
     inline void forEachTable(Functor &&delegate) noexcept
-        { (delegate(get<ComponentTypes>()), ...); }
+        { std::apply([&delegate](auto &...tables) { (delegate(tables), ...); }, _tables); }
+    template<typename Functor>
+    inline void forEachTable(Functor &&delegate) const noexcept
+        { std::apply([&delegate](const auto &...tables) { (delegate(tables), ...); }, _tables); }
+
+
+    /** @brief Release unused memory of every component table of the system */
+    inline void shrinkToFit(void) noexcept
+        { forEachTable([](auto &table) { table.shrinkToFit(); }); }
+
+    /** @brief Get the aggregated memory footprint of every component table of the system */
+    [[nodiscard]] inline TableMemoryUsage memoryUsage(void) const noexcept
+    {
+        TableMemoryUsage total {};
+        forEachTable([&total](const auto &table) { total += table.memoryUsage(); });
+        return total;
+    }
+
+
+    /** @brief Create an owning group over the tables of the given Components
+     *  @note The group keeps unstable member tables co-sorted, see ComponentGroup for maintenance requirements */
+    template<typename ...Components>
+        requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
+    [[nodiscard]] inline auto group(void) noexcept
+        { return ComponentGroup(getTable<Components>()...); }
+
+
+    /** @brief Traverse all entities that own every queried Components in a single pass
+     *  @note The smallest table is used as traversal driver, every other table is probed once per candidate entity
+     *  @note The callback must take (Entity, Components &...) or (Components &...) as arguments
+     *  @note If the callback returns a boolean, traversal is stopped when 'false' is returned */
+    template<typename ...Components, typename Callback>
+        requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
+    void query(Callback &&callback) noexcept;
+
+    /** @brief Traverse all entities that own every queried Components in a single pass (const version) */
+    template<typename ...Components, typename Callback>
+        requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
+    inline void query(Callback &&callback) const noexcept
+        { const_cast<System &>(*this).query<Components...>(std::forward<Callback>(callback)); }
 
 private:
+    /** @brief Cached destination pipeline resolution of cross-pipeline interactions */
+    struct alignas_eighth_cacheline InteractCache
+    {
+        Core::HashedName hash {};
+        PipelineIndex index {};
+    };
+
+    /** @brief Hiden implementation of query function, 'Driver' is the component whose table drives traversal */
+    template<typename Driver, typename ...Components, typename Callback>
+    void queryImpl(Callback &&callback) noexcept;
+
     using Internal::ASystem::queryPipelineIndex;
     using Internal::ASystem::remove;
     using Internal::ASystem::removeRange;
 
     // Cacheline 1 -> ?
+    mutable InteractCache _interactCache {};
     [[no_unique_address]] ComponentTablesTuple _tables {};
 };
 
@@ -53,6 +53,23 @@ inline kF::ECS::EntityRange kF::ECS::System<Literal, TargetPipeline, Allocator,
     return range;
 }
 
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+template<typename ...Initializers>
+inline kF::ECS::EntityRange kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::addRangeCustom(const Entity count, Initializers &&...initializers) noexcept
+{
+    const auto range = addRange(count);
+
+    // Deduce each target component from its initializer signature then bulk fill its table
+    const auto apply = [this, range]<typename Initializer>(Initializer &&initializer) {
+        using Decomposer = Core::FunctionDecomposerHelper<Initializer>;
+        using Component = std::remove_cvref_t<std::tuple_element_t<1, typename Decomposer::ArgsTuple>>;
+        getTable<Component>().addRangeCustom(range, std::forward<Initializer>(initializer));
+    };
+
+    ((apply(std::forward<Initializers>(initializers))), ...);
+    return range;
+}
+
 template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
 template<typename ...Components>
     requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
@@ -154,6 +171,102 @@ inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes..
     Internal::ASystem::removeRange(range);
 }
 
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+template<typename DestinationPipeline, bool RetryOnFailure, typename Callback>
+    requires std::is_invocable_v<Callback, std::span<const kF::ECS::EntityRange>>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::notifyRanges(EntityRangeBatch &batch, Callback &&callback) const noexcept
+{
+    if (batch.empty()) [[unlikely]]
+        return;
+
+    const auto pipelineIndex = getPipelineIndex(DestinationPipeline::Hash);
+    kFEnsure(pipelineIndex.success(),
+        "ECS::System::notifyRanges: Pipeline '", DestinationPipeline::Name, "' is not registered");
+    sendEventOpaque<RetryOnFailure>(*pipelineIndex,
+        [ranges = batch.take(), callback = std::forward<Callback>(callback)]() mutable {
+            callback(std::span<const EntityRange>(ranges.data(), ranges.size()));
+        });
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+template<typename ...Components, typename Callback>
+    requires kF::ECS::SystemComponentRequirements<kF::ECS::Internal::ForwardComponentsTuple<ComponentTypes...>, Components...>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::query(Callback &&callback) noexcept
+{
+    static_assert(sizeof...(Components) != 0, "ECS::System::query: Query requires at least one component");
+
+    // Find the smallest table to use it as traversal driver
+    const EntityIndex counts[] { getTable<Components>().count()... };
+    std::size_t driver {};
+    for (std::size_t index {}; index != sizeof...(Components); ++index) {
+        if (counts[index] < counts[driver])
+            driver = index;
+    }
+
+    // Dispatch implementation with the driver component known at compile time
+    const auto dispatch = [this, &callback, driver]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) {
+        const auto invoke = [this, &callback, driver]<std::size_t Index>(const std::integral_constant<std::size_t, Index>) {
+            if (driver == Index)
+                queryImpl<std::tuple_element_t<Index, std::tuple<Components...>>, Components...>(callback);
+        };
+        (invoke(std::integral_constant<std::size_t, Indexes> {}), ...);
+    };
+    dispatch(std::make_index_sequence<sizeof...(Components)> {});
+}
+
+template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
+template<typename Driver, typename ...Components, typename Callback>
+inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::queryImpl(Callback &&callback) noexcept
+{
+    auto &driverTable = getTable<Driver>();
+    const auto &entities = driverTable.entities();
+
+    for (EntityIndex index {}, count = entities.size(); index != count; ++index) {
+        const auto entity = entities.at(index);
+        // Stable driver tables may contain tombstones
+        if constexpr (std::remove_cvref_t<decltype(driverTable)>::IsStable) {
+            if (entity == NullEntity) [[unlikely]]
+                continue;
+        }
+        // Probe every other table once, the driver component index is already known
+        bool matches = true;
+        const auto probe = [this, entity, index, &matches]<typename Component>(const std::type_identity<Component>) -> EntityIndex {
+            if constexpr (std::is_same_v<std::remove_cvref_t<Component>, std::remove_cvref_t<Driver>>)
+                return index;
+            else {
+                if (!matches) [[unlikely]]
+                    return NullEntityIndex;
+                const auto componentIndex = getTable<Component>().getUnstableIndex(entity);
+                matches = componentIndex != NullEntityIndex;
+                return componentIndex;
+            }
+        };
+        const EntityIndex componentIndexes[] { probe(std::type_identity<Components> {})... };
+        if (!matches)
+            continue;
+        // Hand packed component references to the callback
+        const auto invoke = [this, entity, &callback, &componentIndexes]<std::size_t ...Indexes>(const std::index_sequence<Indexes...>) -> bool {
+            if constexpr (std::is_invocable_v<Callback, Entity, Components &...>) {
+                if constexpr (std::is_same_v<std::invoke_result_t<Callback, Entity, Components &...>, bool>)
+                    return callback(entity, getTable<Components>().atIndex(componentIndexes[Indexes])...);
+                else {
+                    callback(entity, getTable<Components>().atIndex(componentIndexes[Indexes])...);
+                    return true;
+                }
+            } else {
+                if constexpr (std::is_same_v<std::invoke_result_t<Callback, Components &...>, bool>)
+                    return callback(getTable<Components>().atIndex(componentIndexes[Indexes])...);
+                else {
+                    callback(getTable<Components>().atIndex(componentIndexes[Indexes])...);
+                    return true;
+                }
+            }
+        };
+        if (!invoke(std::make_index_sequence<sizeof...(Components)> {}))
+            break;
+    }
+}
+
 template<kF::Core::FixedString Literal, kF::ECS::Pipeline TargetPipeline, kF::Core::StaticAllocatorRequirements Allocator, typename ...ComponentTypes>
 template<bool RetryOnFailure, typename Callback>
 inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes...>::interact(Callback &&callback) const noexcept
@@ -204,11 +317,18 @@ inline void kF::ECS::System<Literal, TargetPipeline, Allocator, ComponentTypes..
         invoke(std::forward<Callback>(callback));
     // Else, send event to target pipeline
     } else {
-        const auto pipelineIndex = getPipelineIndex(DestinationPipeline::Hash);
-        kFEnsure(pipelineIndex.success(),
-            "ECS::System::interact: Pipeline '", DestinationPipeline::Name, "' is not registered");
-        sendEventOpaque<RetryOnFailure>(*pipelineIndex, [invoke, callback = std::forward<Callback>(callback)]() mutable {
-            // 'pipelineIndex' could be cached but this would increase chances to use allocation
+        // Resolve the destination pipeline once per system then reuse the cached index
+        PipelineIndex pipelineIndex;
+        if (_interactCache.hash == DestinationPipeline::Hash) [[likely]]
+            pipelineIndex = _interactCache.index;
+        else {
+            const auto expected = getPipelineIndex(DestinationPipeline::Hash);
+            kFEnsure(expected.success(),
+                "ECS::System::interact: Pipeline '", DestinationPipeline::Name, "' is not registered");
+            _interactCache = InteractCache { .hash = DestinationPipeline::Hash, .index = *expected };
+            pipelineIndex = *expected;
+        }
+        sendEventOpaque<RetryOnFailure>(pipelineIndex, [invoke, callback = std::forward<Callback>(callback)]() mutable {
             invoke(callback);
         });
     }
@@ -3,11 +3,17 @@
  * @ Description: Unit tests of System
  */
 
+#include <atomic>
+#include <cstring>
+
 #include <gtest/gtest.h>
 
 #include <Kube/Core/Random.hpp>
+#include <Kube/Flow/Scheduler.hpp>
 
 #include <Kube/ECS/ComponentTable.hpp>
+#include <Kube/ECS/ComponentSnapshot.hpp>
+#include <Kube/ECS/SoAComponentTable.hpp>
 #include <Kube/ECS/StableComponentTable.hpp>
 
 using namespace kF;
@@ -74,6 +80,23 @@ void TestTableAddRemoveRange(void) noexcept
     for (auto it = TestEntityRange.begin; it != TestEntityRange.end; ++it) {
         ASSERT_FALSE(table.exists(it));
     }
+
+    // Add entities after a partial range removal, components must stay paired with their entity
+    table.addRange(TestEntityRange);
+    table.removeRange(ECS::EntityRange { 25u, 75u });
+    ASSERT_EQ(table.count(), 50u);
+    const auto componentA = table.add(200u, std::make_unique<int>(42)).get();
+    const auto componentB = table.add(201u, std::make_unique<int>(43)).get();
+    ASSERT_EQ(table.get(200u).get(), componentA);
+    ASSERT_EQ(table.get(201u).get(), componentB);
+    ASSERT_EQ(*table.get(200u), 42);
+    ASSERT_EQ(*table.get(201u), 43);
+
+    // Swap removal after the range removal must relocate the right component
+    table.remove(200u);
+    ASSERT_FALSE(table.exists(200u));
+    ASSERT_EQ(table.get(201u).get(), componentB);
+    ASSERT_EQ(*table.get(201u), 43);
 }
 
 template<typename TableType>
@@ -437,6 +460,115 @@ void TestTableSortBug02(void) noexcept
 }
 
 
+template<typename TableType>
+void TestTableEnsureSorted(void) noexcept
+{
+    constexpr auto SortFunc = [](const ECS::Entity lhs, const ECS::Entity rhs) { return lhs < rhs; };
+
+    TableType table;
+
+    for (const ECS::Entity entity : { 5u, 3u, 9u, 1u, 7u })
+        table.add(entity, std::make_unique<int>(static_cast<int>(entity)));
+
+    // Restore order then verify entities, components and sparse set stay consistent
+    table.ensureSorted(SortFunc);
+    ECS::Entity previous {};
+    for (const auto entity : table.entities()) {
+        ASSERT_LT(previous, entity);
+        previous = entity;
+        ASSERT_EQ(*table.get(entity), static_cast<int>(entity));
+    }
+
+    // A nearly sorted table only has to move the newcomer
+    table.add(4u, std::make_unique<int>(4));
+    table.ensureSorted(SortFunc);
+    previous = 0u;
+    for (const auto entity : table.entities()) {
+        ASSERT_LT(previous, entity);
+        previous = entity;
+        ASSERT_EQ(*table.get(entity), static_cast<int>(entity));
+    }
+    for (auto i = 0u; const auto entity : table.entities()) {
+        ASSERT_EQ(i, table.getUnstableIndex(entity));
+        ++i;
+    }
+}
+
+template<typename TableType>
+void TestTableTraverseParallel(void) noexcept
+{
+    constexpr ECS::Entity EntityCount = 1024u;
+    constexpr ECS::EntityIndex GrainSize = 64u;
+
+    Flow::Scheduler scheduler;
+    TableType table;
+    std::uint64_t expectedSum {};
+
+    for (ECS::Entity entity = 1u; entity != EntityCount + 1u; ++entity) {
+        table.add(entity, std::make_unique<int>(static_cast<int>(entity)));
+        expectedSum += entity;
+    }
+
+    // Traverse with a grain size small enough to span several tasks
+    std::atomic<std::uint64_t> sum { 0u };
+    table.traverseParallel(scheduler, [&sum](const ECS::Entity entity, TestComponent &component) {
+        ASSERT_EQ(static_cast<int>(entity), *component);
+        sum += entity;
+    }, GrainSize);
+    ASSERT_EQ(sum, expectedSum);
+}
+
+template<typename TableType>
+void TestTableRecordTraverseParallel(void) noexcept
+{
+    constexpr ECS::Entity EntityCount = 512u;
+    constexpr ECS::EntityIndex TaskCount = 4u;
+
+    Flow::Scheduler scheduler;
+    TableType table;
+    std::atomic<std::uint64_t> sum { 0u };
+    std::uint64_t expectedSum {};
+
+    // Record tasks before the table is filled: slices are computed at execution time
+    Flow::Graph graph;
+    table.recordTraverseParallel(graph, [&sum](const ECS::Entity entity, TestComponent &) {
+        sum += entity;
+    }, TaskCount);
+
+    for (ECS::Entity entity = 1u; entity != EntityCount + 1u; ++entity) {
+        table.add(entity, std::make_unique<int>(static_cast<int>(entity)));
+        expectedSum += entity;
+    }
+
+    scheduler.schedule(graph);
+    graph.waitSpin();
+    ASSERT_EQ(sum, expectedSum);
+}
+
+template<typename TableType>
+void TestTableForEachChunk(void) noexcept
+{
+    constexpr ECS::Entity EntityCount = 1024u;
+
+    TableType table;
+
+    for (ECS::Entity entity = 1u; entity != EntityCount + 1u; ++entity)
+        table.add(entity, std::make_unique<int>(static_cast<int>(entity)));
+
+    // Every live slot must be visited exactly once with matching spans
+    ECS::EntityIndex visited {};
+    table.forEachChunk([&visited](const std::span<const ECS::Entity> entities, const std::span<TestComponent> components) {
+        ASSERT_EQ(entities.size(), components.size());
+        for (std::size_t index {}; index != entities.size(); ++index) {
+            if (entities[index] == ECS::NullEntity)
+                continue;
+            ASSERT_EQ(static_cast<int>(entities[index]), *components[index]);
+            ++visited;
+        }
+    });
+    ASSERT_EQ(visited, table.count());
+}
+
 #define TEST_COMPONENT_TABLE(TableName, TableType) \
 TEST(TableName, Basics) { TestTableBasics<TableType>(); } \
 TEST(TableName, AddRemove) { TestTableAddRemove<TableType>(); } \
@@ -446,7 +578,11 @@ TEST(TableName, Extract) { TestTableExtract<TableType>(); } \
 TEST(TableName, Sort) { TestTableSort<TableType>(); } \
 TEST(TableName, SortBug01) { TestTableSortBug01<TableType>(); } \
 TEST(TableName, SortBug02) { TestTableSortBug02<TableType>(); } \
+TEST(TableName, EnsureSorted) { TestTableEnsureSorted<TableType>(); } \
 TEST(TableName, Traverse) { TestTableTraverse<TableType>(); } \
+TEST(TableName, TraverseParallel) { TestTableTraverseParallel<TableType>(); } \
+TEST(TableName, RecordTraverseParallel) { TestTableRecordTraverseParallel<TableType>(); } \
+TEST(TableName, ForEachChunk) { TestTableForEachChunk<TableType>(); } \
 TEST(TableName, Clear) { TestTableClear<TableType>(); } \
 TEST(TableName, Release) { TestTableRelease<TableType>(); }
 
@@ -456,6 +592,316 @@ using StableComponentTableType = ECS::StableComponentTable<TestComponent, 4096 /
 TEST_COMPONENT_TABLE(ComponentTable, ComponentTableType)
 TEST_COMPONENT_TABLE(StableComponentTable, StableComponentTableType)
 
+template<typename TableType>
+void TestTableSnapshotRoundTrip(void) noexcept
+{
+    TableType src;
+
+    for (ECS::Entity entity = 1u; entity != 600u; ++entity)
+        src.add(entity, static_cast<int>(entity * 2u));
+    // Stable tables serialize packed, holes must vanish from the snapshot
+    src.tryRemove(10u);
+    src.tryRemove(42u);
+
+    // Serialize into a byte buffer
+    std::vector<std::byte> buffer;
+    src.serialize([&buffer](const void * const data, const std::size_t bytes) {
+        const auto bytePtr = reinterpret_cast<const std::byte *>(data);
+        buffer.insert(buffer.end(), bytePtr, bytePtr + bytes);
+    });
+
+    // Deserialize into a fresh table
+    TableType dst;
+    std::size_t offset {};
+    dst.deserialize([&buffer, &offset](void * const data, const std::size_t bytes) {
+        std::memcpy(data, buffer.data() + offset, bytes);
+        offset += bytes;
+    });
+    ASSERT_EQ(offset, buffer.size());
+
+    // Both tables must match
+    ASSERT_EQ(dst.count(), src.count());
+    for (ECS::Entity entity = 1u; entity != 600u; ++entity) {
+        ASSERT_EQ(dst.exists(entity), src.exists(entity));
+        if (src.exists(entity))
+            ASSERT_EQ(dst.get(entity), static_cast<int>(entity * 2u));
+    }
+}
+
+TEST(ComponentTable, SnapshotRoundTrip)
+{
+    TestTableSnapshotRoundTrip<ECS::ComponentTable<int, 4096 / sizeof(ECS::Entity)>>();
+}
+
+TEST(StableComponentTable, SnapshotRoundTrip)
+{
+    TestTableSnapshotRoundTrip<ECS::StableComponentTable<int, 256u, 4096 / sizeof(ECS::Entity)>>();
+}
+
+TEST(ComponentTable, ShrinkToFit)
+{
+    ECS::ComponentTable<int, 4096 / sizeof(ECS::Entity)> table;
+
+    table.addRange(ECS::EntityRange { .begin = 1u, .end = 1001u }, 7);
+    table.removeRange(ECS::EntityRange { .begin = 101u, .end = 1001u });
+    const auto before = table.memoryUsage();
+    ASSERT_GT(before.allocatedBytes, before.usedBytes);
+
+    // Shrinking reclaims slack without touching content
+    table.shrinkToFit();
+    const auto after = table.memoryUsage();
+    ASSERT_EQ(after.usedBytes, before.usedBytes);
+    ASSERT_LT(after.allocatedBytes, before.allocatedBytes);
+    ASSERT_GE(after.allocatedBytes, after.usedBytes);
+    for (ECS::Entity entity = 1u; entity != 101u; ++entity)
+        ASSERT_EQ(table.get(entity), 7);
+}
+
+TEST(StableComponentTable, ShrinkToFit)
+{
+    ECS::StableComponentTable<int, 256u, 4096 / sizeof(ECS::Entity)> table;
+
+    // Three pages, gut the middle one entirely
+    table.addRange(ECS::EntityRange { .begin = 1u, .end = 601u }, 7);
+    for (ECS::Entity entity = 257u; entity != 513u; ++entity)
+        table.remove(entity);
+    const auto before = table.memoryUsage();
+
+    // The all tombstone page is freed, live components stay in place
+    table.shrinkToFit();
+    const auto after = table.memoryUsage();
+    ASSERT_LT(after.allocatedBytes, before.allocatedBytes);
+    ASSERT_EQ(table.count(), 344u);
+    ASSERT_EQ(table.get(1u), 7);
+    ASSERT_EQ(table.get(600u), 7);
+
+    // Freed pages are revived on demand when tombstone slots are reused
+    table.add(1000u, 9);
+    ASSERT_EQ(table.get(1000u), 9);
+}
+
+struct Particle
+{
+    float x {};
+    float y {};
+    float vx {};
+    float vy {};
+    std::uint64_t payload {};
+};
+
+TEST(SoAComponentTable, Basics)
+{
+    ECS::SoAComponentTable<Particle, 4096 / sizeof(ECS::Entity), Core::DefaultStaticAllocator,
+        &Particle::x, &Particle::vx, &Particle::payload> table;
+
+    // Scatter on insertion, gather on get
+    table.add(1u, Particle { .x = 1.0f, .y = 9.0f, .vx = 2.0f, .payload = 42u });
+    table.add(2u, Particle { .x = 3.0f, .vx = 4.0f, .payload = 43u });
+    ASSERT_EQ(table.count(), 2u);
+    const auto particle = table.get(1u);
+    ASSERT_EQ(particle.x, 1.0f);
+    ASSERT_EQ(particle.vx, 2.0f);
+    ASSERT_EQ(particle.payload, 42u);
+    // Fields not listed are not stored
+    ASSERT_EQ(particle.y, 0.0f);
+
+    // Field access & mutation
+    table.getField<&Particle::x>(2u) = 5.0f;
+    ASSERT_EQ(table.get(2u).x, 5.0f);
+
+    // Subset traversal only touches the selected streams
+    table.traverseFields<&Particle::x, &Particle::vx>([](float &x, float &vx) {
+        x += vx;
+    });
+    ASSERT_EQ(table.get(1u).x, 3.0f);
+    ASSERT_EQ(table.get(2u).x, 9.0f);
+
+    // Packed field spans are exposed for vectorized kernels
+    const auto xs = table.field<&Particle::x>();
+    ASSERT_EQ(xs.size(), 2u);
+
+    // Swap removal keeps every field vector aligned
+    table.remove(1u);
+    ASSERT_FALSE(table.exists(1u));
+    ASSERT_EQ(table.get(2u).x, 9.0f);
+    ASSERT_EQ(table.get(2u).payload, 43u);
+}
+
+TEST(ComponentSnapshot, PublishRead)
+{
+    ECS::ComponentTable<int, 4096 / sizeof(ECS::Entity)> table;
+    ECS::ComponentSnapshot<int> snapshot(16u);
+
+    table.add(1u, 10);
+    table.add(2u, 20);
+    snapshot.publish(table);
+
+    // Readers observe the published copy
+    snapshot.read([](const std::span<const ECS::Entity> entities, const std::span<const int> components) {
+        ASSERT_EQ(entities.size(), 2u);
+        ASSERT_EQ(components.size(), 2u);
+        ASSERT_EQ(entities[0], 1u);
+        ASSERT_EQ(components[0], 10);
+    });
+
+    // Mutations are invisible until the next publish
+    table.get(2u) = 21;
+    snapshot.read([](const std::span<const ECS::Entity>, const std::span<const int> components) {
+        ASSERT_EQ(components[1], 20);
+    });
+    snapshot.publish(table);
+    snapshot.read([](const std::span<const ECS::Entity>, const std::span<const int> components) {
+        ASSERT_EQ(components[1], 21);
+    });
+}
+
+TEST(ComponentTable, ChangeTracking)
+{
+    ECS::ComponentTable<int, 4096 / sizeof(ECS::Entity), Core::DefaultStaticAllocator, true> table;
+
+    static_assert(decltype(table)::IsChangeTracked, "Table must be change tracked");
+
+    // Every fresh insertion counts as a change
+    table.add(1u, 10);
+    table.add(2u, 20);
+    std::vector<ECS::Entity> changed;
+    table.traverseChanged([&changed](const ECS::Entity entity, int &) { changed.push_back(entity); });
+    ASSERT_EQ(changed, (std::vector<ECS::Entity> { 1u, 2u }));
+
+    // Nothing changed since the last traversal
+    changed.clear();
+    table.traverseChanged([&changed](const ECS::Entity entity, int &) { changed.push_back(entity); });
+    ASSERT_TRUE(changed.empty());
+
+    // Mutable get stamps, const get does not
+    table.get(2u) = 21;
+    ASSERT_EQ(std::as_const(table).get(1u), 10);
+    table.traverseChanged([&changed](const ECS::Entity entity, int &) { changed.push_back(entity); });
+    ASSERT_EQ(changed, (std::vector<ECS::Entity> { 2u }));
+
+    // tryAdd updates count as changes, swap removal keeps versions aligned
+    changed.clear();
+    table.tryAdd(1u, 11);
+    table.add(3u, 30);
+    table.remove(1u);
+    table.traverseChanged([&changed](const ECS::Entity entity, int &) { changed.push_back(entity); });
+    ASSERT_EQ(changed, (std::vector<ECS::Entity> { 3u }));
+}
+
+struct SelectedTag {};
+
+TEST(ComponentTable, TagComponent)
+{
+    ECS::ComponentTable<SelectedTag, 4096 / sizeof(ECS::Entity)> table;
+
+    static_assert(decltype(table)::IsTagComponent, "Empty components must collapse to tag storage");
+
+    // Pure sparse set operations
+    table.add(1u);
+    table.add(2u, SelectedTag {});
+    table.tryAdd(3u, SelectedTag {});
+    ASSERT_EQ(table.count(), 3u);
+    ASSERT_TRUE(table.exists(1u));
+    ASSERT_TRUE(table.exists(2u));
+    ASSERT_TRUE(table.exists(3u));
+
+    // Entity only traversal
+    ECS::EntityIndex visited {};
+    table.traverse([&visited](const ECS::Entity) { ++visited; });
+    ASSERT_EQ(visited, 3u);
+
+    // Removal keeps the dense entity list consistent
+    table.remove(2u);
+    ASSERT_EQ(table.count(), 2u);
+    ASSERT_FALSE(table.exists(2u));
+    ASSERT_TRUE(table.exists(1u));
+    ASSERT_TRUE(table.exists(3u));
+
+    // Ranges behave as usual
+    table.addRange(ECS::EntityRange { .begin = 10u, .end = 20u });
+    ASSERT_EQ(table.count(), 12u);
+    table.removeRange(ECS::EntityRange { .begin = 10u, .end = 20u });
+    ASSERT_EQ(table.count(), 2u);
+}
+
+TEST(StableComponentTable, AddRangeReusesTombstones)
+{
+    ECS::StableComponentTable<int, 256u, 4096 / sizeof(ECS::Entity)> table;
+
+    for (ECS::Entity entity = 1u; entity != 7u; ++entity)
+        table.add(entity, static_cast<int>(entity));
+    table.remove(2u);
+    table.remove(4u);
+
+    // The range must fill both holes before appending
+    table.addRange(ECS::EntityRange { .begin = 10u, .end = 14u }, 99);
+    ASSERT_EQ(table.count(), 8u);
+    ASSERT_EQ(table.entities().size(), 8u);
+    for (ECS::Entity entity = 10u; entity != 14u; ++entity) {
+        ASSERT_TRUE(table.exists(entity));
+        ASSERT_EQ(table.get(entity), 99);
+    }
+    ASSERT_EQ(table.get(1u), 1);
+    ASSERT_EQ(table.get(6u), 6);
+
+    // Removing a range trims trailing dead slots instead of keeping tombstones
+    table.removeRange(ECS::EntityRange { .begin = 10u, .end = 14u });
+    ASSERT_EQ(table.count(), 4u);
+    ASSERT_EQ(table.entities().size(), 6u);
+}
+
+TEST(StableComponentTable, IteratorSkipsTombstones)
+{
+    StableComponentTableType table;
+
+    for (ECS::Entity entity = 1u; entity != 7u; ++entity)
+        table.add(entity, std::make_unique<int>(static_cast<int>(entity)));
+
+    // Punch holes at the first, an inner and the trailing slot
+    table.remove(1u);
+    table.remove(3u);
+    table.remove(6u);
+
+    // Iteration must only visit live slots, in slot order
+    std::vector<int> visited;
+    for (const auto &component : table)
+        visited.push_back(*component);
+    ASSERT_EQ(visited, (std::vector<int> { 2, 4, 5 }));
+}
+
+TEST(StableComponentTable, CompactStep)
+{
+    StableComponentTableType table;
+
+    for (ECS::Entity entity = 1u; entity != 11u; ++entity)
+        table.add(entity, std::make_unique<int>(static_cast<int>(entity)));
+
+    // Punch three holes, 30% tombstones exceeds the default 25% threshold
+    table.remove(2u);
+    table.remove(4u);
+    table.remove(6u);
+    ASSERT_TRUE(table.needsCompaction());
+
+    // A bounded step only relocates up to its budget
+    ASSERT_EQ(table.compactStep(2u), 2u);
+    ASSERT_EQ(table.count(), 7u);
+
+    // The next step converges to a dense table
+    ASSERT_EQ(table.compactStep(10u), 1u);
+    ASSERT_FALSE(table.needsCompaction());
+    ASSERT_EQ(table.count(), 7u);
+    ASSERT_EQ(table.entities().size(), 7u);
+
+    // Every surviving component is intact and correctly indexed
+    for (const ECS::Entity entity : { 1u, 3u, 5u, 7u, 8u, 9u, 10u }) {
+        ASSERT_TRUE(table.exists(entity));
+        ASSERT_EQ(*table.get(entity), static_cast<int>(entity));
+    }
+
+    // A dense table reports no work
+    ASSERT_EQ(table.compactStep(10u), 0u);
+}
+
 TEST(StableComponentTable, PackSparseHoles)
 {
     static constexpr ECS::EntityRange TestEntityRange { 0u, 100u };
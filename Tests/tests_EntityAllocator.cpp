@@ -0,0 +1,92 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of EntityAllocator
+ */
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/EntityAllocator.hpp>
+
+using namespace kF;
+
+TEST(EntityAllocator, Basics)
+{
+    ECS::EntityAllocator allocator;
+
+    // First entity is 1
+    const auto entity = allocator.allocate();
+    ASSERT_EQ(entity, 1u);
+
+    // Releasing the tail shrinks the horizon
+    allocator.release(entity);
+    ASSERT_EQ(allocator.allocate(), 1u);
+}
+
+TEST(EntityAllocator, RangeReuse)
+{
+    ECS::EntityAllocator allocator;
+
+    const auto range = allocator.allocateRange(10u);
+    ASSERT_EQ(range, (ECS::EntityRange { .begin = 1u, .end = 11u }));
+
+    // A hole in the middle is reused by an exactly fitting range
+    const auto hole = ECS::EntityRange { .begin = 3u, .end = 7u };
+    allocator.releaseRange(hole);
+    ASSERT_EQ(allocator.allocateRange(4u), hole);
+
+    // A too large request extends the horizon instead
+    allocator.releaseRange(hole);
+    const auto range2 = allocator.allocateRange(5u);
+    ASSERT_EQ(range2.begin, 11u);
+}
+
+TEST(EntityAllocator, Generations)
+{
+    ECS::EntityAllocator allocator;
+
+    // A fresh entity is alive at generation zero
+    const auto entity = allocator.allocate();
+    const auto handle = allocator.makeHandle(entity);
+    ASSERT_EQ(handle.generation, 0u);
+    ASSERT_TRUE(allocator.isAlive(handle));
+
+    // Releasing bumps the generation, staling the handle
+    allocator.release(entity);
+    ASSERT_FALSE(allocator.isAlive(handle));
+
+    // The recycled identifier gets a fresh generation
+    const auto recycled = allocator.allocate();
+    ASSERT_EQ(recycled, entity);
+    const auto handle2 = allocator.makeHandle(recycled);
+    ASSERT_NE(handle, handle2);
+    ASSERT_TRUE(allocator.isAlive(handle2));
+    ASSERT_FALSE(allocator.isAlive(handle));
+
+    // Null handles are never alive
+    ASSERT_FALSE(allocator.isAlive(ECS::EntityHandle {}));
+}
+
+TEST(EntityAllocator, Coalescing)
+{
+    ECS::EntityAllocator allocator;
+
+    const auto range = allocator.allocateRange(9u);
+    ASSERT_EQ(range.end, 10u);
+
+    // Release three non-adjacent single entities then the entities between them
+    allocator.release(2u);
+    allocator.release(6u);
+    allocator.release(4u);
+    ASSERT_EQ(allocator.freeRanges().size(), 3u);
+    allocator.release(3u);
+    allocator.release(5u);
+
+    // All five holes must have coalesced into one range
+    ASSERT_EQ(allocator.freeRanges().size(), 1u);
+    ASSERT_EQ(allocator.freeRanges().front(), (ECS::EntityRange { .begin = 2u, .end = 7u }));
+
+    // Releasing the tail absorbs an adjacent free range
+    allocator.releaseRange(ECS::EntityRange { .begin = 7u, .end = 10u });
+    ASSERT_TRUE(allocator.freeRanges().empty());
+    ASSERT_EQ(allocator.lastEntity(), 1u);
+}
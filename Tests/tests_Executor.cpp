@@ -294,6 +294,191 @@ TEST(Executor, GameScenario)
 }
 
 
+// Component used to declare conflicting or read-only accesses
+struct AccessProbe
+{
+    int value {};
+};
+
+using AccessPipeline = ECS::PipelineTag<"Access"_fixed>;
+
+// System whose graph sleeps while flagging its execution window
+template<auto Literal, typename ...Components>
+class GraphSleepSystem : public ECS::System<Literal, AccessPipeline, Core::DefaultStaticAllocator, Components...>
+{
+public:
+    GraphSleepSystem(std::atomic_bool *running) : _running(running)
+    {
+        this->taskGraph().add([running = _running] {
+            running->store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            running->store(false);
+        });
+    }
+
+    [[nodiscard]] bool tick(void) noexcept override { return true; }
+
+private:
+    std::atomic_bool *_running {};
+};
+
+// System observing whether another system's graph runs while it ticks
+template<auto Literal, typename ...Components>
+class ObserverSystem : public ECS::System<Literal, AccessPipeline, Core::DefaultStaticAllocator, Components...>
+{
+public:
+    ObserverSystem(std::atomic_bool *watched, std::atomic_size_t *ticks, std::atomic_size_t *concurrent)
+        : _watched(watched), _ticks(ticks), _concurrent(concurrent) {}
+
+    [[nodiscard]] bool tick(void) noexcept override
+    {
+        ++*_ticks;
+        if (_watched->load())
+            ++*_concurrent;
+        return false;
+    }
+
+private:
+    std::atomic_bool *_watched {};
+    std::atomic_size_t *_ticks {};
+    std::atomic_size_t *_concurrent {};
+};
+
+TEST(Executor, ConflictingAccessesAreSequenced)
+{
+    ECS::Executor executor(4u);
+    std::atomic_bool writerRunning { false };
+    std::atomic_size_t observerTicks {};
+    std::atomic_size_t concurrent {};
+
+    executor.addPipeline<AccessPipeline>(20ll);
+    // Both systems write the same component: the observer tick must wait out the writer graph
+    executor.addSystem<GraphSleepSystem<"SleepWriter"_fixed, AccessProbe>>(&writerRunning);
+    executor.addSystem<ObserverSystem<"Observer"_fixed, AccessProbe>>(&writerRunning, &observerTicks, &concurrent);
+
+    std::thread thd([&executor] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        executor.stop();
+    });
+    executor.run();
+    if (thd.joinable())
+        thd.join();
+
+    ASSERT_GT(observerTicks, 0u);
+    ASSERT_EQ(concurrent, 0u);
+}
+
+TEST(Executor, ReadOnlyAccessesRunConcurrently)
+{
+    ECS::Executor executor(4u);
+    std::atomic_bool readerRunning { false };
+    std::atomic_size_t observerTicks {};
+    std::atomic_size_t concurrent {};
+
+    executor.addPipeline<AccessPipeline>(20ll);
+    // Both systems only read the component: the observer tick may overlap the reader graph
+    executor.addSystem<GraphSleepSystem<"SleepReader"_fixed, ECS::Read<AccessProbe>>>(&readerRunning);
+    executor.addSystem<ObserverSystem<"Observer"_fixed, ECS::Read<AccessProbe>>>(&readerRunning, &observerTicks, &concurrent);
+
+    std::thread thd([&executor] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        executor.stop();
+    });
+    executor.run();
+    if (thd.joinable())
+        thd.join();
+
+    ASSERT_GT(observerTicks, 0u);
+    ASSERT_GT(concurrent, 0u);
+}
+
+TEST(Executor, FalseBeginPassSkipsPipeline)
+{
+    ECS::Executor executor;
+    std::atomic_bool unused { false };
+    std::atomic_size_t observerTicks {};
+    std::atomic_size_t concurrent {};
+
+    // The begin pass always refuses execution, no system of the pipeline may tick
+    executor.addPipeline<AccessPipeline>(100ll, ECS::Executor::DefaultPipelineEventQueueSize,
+        [](void) -> bool { return false; });
+    executor.addSystem<ObserverSystem<"Observer"_fixed, AccessProbe>>(&unused, &observerTicks, &concurrent);
+
+    std::thread thd([&executor] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        executor.stop();
+    });
+    executor.run();
+    if (thd.joinable())
+        thd.join();
+
+    ASSERT_EQ(observerTicks, 0u);
+}
+
+TEST(Executor, SendEventsBatch)
+{
+    using BatchPipeline = ECS::PipelineTag<"Batch"_fixed>;
+
+    ECS::Executor executor;
+    std::atomic_size_t counter {};
+
+    executor.addPipeline<BatchPipeline>(100ll);
+
+    // A whole batch is delivered through a single call
+    std::array<ECS::PipelineEvent, 3> events {
+        ECS::PipelineEvent([&counter] { ++counter; }),
+        ECS::PipelineEvent([&counter] { counter += 2u; }),
+        ECS::PipelineEvent([&counter] { counter += 4u; })
+    };
+    executor.sendEvents<BatchPipeline>(std::span<ECS::PipelineEvent>(events));
+
+    std::thread thd([&executor] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        executor.stop();
+    });
+    executor.run();
+    if (thd.joinable())
+        thd.join();
+
+    // Every event ran exactly once
+    ASSERT_EQ(counter, 7u);
+}
+
+using MultiWorldPipeline = ECS::PipelineTag<"MultiWorld"_fixed>;
+
+class MultiWorldSystem : public ECS::System<"MultiWorld", MultiWorldPipeline>
+{
+public:
+};
+
+TEST(Executor, MultiWorld)
+{
+    ECS::Executor first;
+    ASSERT_EQ(&ECS::Executor::Get(), &first);
+    {
+        // A second executor may coexist, the default instance stays the first one
+        ECS::Executor second(2u);
+        ASSERT_EQ(&ECS::Executor::Get(), &first);
+
+        first.addPipeline<MultiWorldPipeline>(60ll);
+        second.addPipeline<MultiWorldPipeline>(60ll);
+
+        // Systems bind to the executor that constructed them
+        auto &firstSystem = first.addSystem<MultiWorldSystem>();
+        auto &secondSystem = second.addSystem<MultiWorldSystem>();
+        ASSERT_NE(&firstSystem, &secondSystem);
+        ASSERT_EQ(&firstSystem.parent(), &first);
+        ASSERT_EQ(&secondSystem.parent(), &second);
+
+        // Entity allocation is independent per world
+        ASSERT_EQ(firstSystem.add(), 1u);
+        ASSERT_EQ(firstSystem.add(), 2u);
+        ASSERT_EQ(secondSystem.add(), 1u);
+    }
+    // Destroying a secondary world keeps the default instance intact
+    ASSERT_EQ(&ECS::Executor::Get(), &first);
+}
+
 // Generate individual tests of each work type
 GENERATE_EXECUTOR_INDIVIDUAL_SAMPLE_TIMING_RANGE(NoWork)
 GENERATE_EXECUTOR_INDIVIDUAL_SAMPLE_TIMING_RANGE(NegligableWork)
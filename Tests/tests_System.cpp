@@ -3,9 +3,14 @@
  * @ Description: Unit tests of System
  */
 
+#include <algorithm>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <Kube/ECS/Executor.hpp>
+#include <Kube/ECS/CommandBuffer.hpp>
+#include <Kube/ECS/StaticSystemChain.hpp>
 
 using namespace kF;
 
@@ -207,6 +212,237 @@ TEST(System, TwoComponents)
     ASSERT_FALSE(foo.getTable<BarB>().exists(entityC));
 }
 
+TEST(System, Query)
+{
+    ECS::Executor executor;
+    executor.addPipeline<DummyPipeline>(60);
+    auto &foo = executor.addSystem<BarSystem>();
+
+    // Entities with a single component must not match the query
+    const auto entityA = foo.add(BarA { 1 });
+    const auto entityB = foo.add(BarB { 2.0f });
+
+    // Entities with both components must match the query
+    const auto entityC = foo.add(BarA { 3 }, BarB { 4.0f });
+    const auto entityD = foo.add(BarA { 5 }, BarB { 6.0f });
+
+    // Query both components
+    std::vector<ECS::Entity> visited;
+    foo.query<BarA, BarB>([&visited](const ECS::Entity entity, BarA &barA, BarB &barB) {
+        visited.push_back(entity);
+        barA.value += 1;
+        barB.value += 1.0f;
+    });
+    ASSERT_EQ(visited.size(), 2u);
+    ASSERT_NE(std::find(visited.begin(), visited.end(), entityC), visited.end());
+    ASSERT_NE(std::find(visited.begin(), visited.end(), entityD), visited.end());
+    ASSERT_EQ(foo.get<BarA>(entityC).value, 4);
+    ASSERT_EQ(foo.get<BarB>(entityD).value, 7.0f);
+
+    // Unmatched entities are untouched
+    ASSERT_EQ(foo.get<BarA>(entityA).value, 1);
+    ASSERT_EQ(foo.get<BarB>(entityB).value, 2.0f);
+
+    // Query without entity argument and early exit
+    std::size_t count {};
+    foo.query<BarA, BarB>([&count](BarA &, BarB &) {
+        ++count;
+        return false;
+    });
+    ASSERT_EQ(count, 1u);
+}
+
+TEST(System, FrameAlloc)
+{
+    ECS::Executor executor;
+    executor.addPipeline<DummyPipeline>(60);
+    auto &useless = executor.addSystem<UselessSystem>();
+
+    // Two allocations must not overlap
+    const auto first = useless.frameAlloc<int>(8u);
+    const auto second = useless.frameAlloc<int>(8u);
+    ASSERT_EQ(first.size(), 8u);
+    ASSERT_GE(second.data(), first.data() + first.size());
+
+    // Over aligned types come back correctly aligned
+    struct alignas(64) OverAligned { std::byte bytes[64]; };
+    const auto overAligned = useless.frameAlloc<OverAligned>(1u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(overAligned.data()) % 64u, 0u);
+
+    // The arena is recycled by reset
+    auto &arena = executor.tickArena(0u);
+    const auto used = arena.used();
+    ASSERT_GE(used, 2u * 8u * sizeof(int));
+    arena.reset();
+    ASSERT_EQ(arena.used(), 0u);
+    const auto third = useless.frameAlloc<int>(8u);
+    ASSERT_EQ(third.data(), first.data());
+}
+
+TEST(System, EntityRangeBatch)
+{
+    ECS::EntityRangeBatch batch;
+
+    ASSERT_TRUE(batch.empty());
+
+    // Record out of order entities and ranges
+    batch.add(7u);
+    batch.add(ECS::EntityRange { .begin = 1u, .end = 4u });
+    batch.add(4u);
+    batch.add(ECS::EntityRange { .begin = 10u, .end = 12u });
+    batch.add(8u);
+
+    // Everything adjacent or overlapping collapses into three ranges
+    batch.coalesce();
+    ASSERT_EQ(batch.ranges().size(), 3u);
+    ASSERT_EQ(batch.ranges().at(0u), (ECS::EntityRange { .begin = 1u, .end = 5u }));
+    ASSERT_EQ(batch.ranges().at(1u), (ECS::EntityRange { .begin = 7u, .end = 9u }));
+    ASSERT_EQ(batch.ranges().at(2u), (ECS::EntityRange { .begin = 10u, .end = 12u }));
+
+    // Taking consumes the batch
+    const auto ranges = batch.take();
+    ASSERT_EQ(ranges.size(), 3u);
+    ASSERT_TRUE(batch.empty());
+}
+
+TEST(System, AddRangeCustom)
+{
+    ECS::Executor executor;
+    executor.addPipeline<DummyPipeline>(60);
+    auto &foo = executor.addSystem<BarSystem>();
+
+    // Spawn a wave with per entity data for both components
+    const auto range = foo.addRangeCustom(5u,
+        [](const ECS::EntityIndex index, BarA &barA) { barA.value = static_cast<int>(index); },
+        [](const ECS::EntityIndex index, BarB &barB) { barB.value = static_cast<float>(index) * 2.0f; });
+    ASSERT_EQ(range.size(), 5u);
+
+    for (auto it = range.begin; it != range.end; ++it) {
+        const auto index = it - range.begin;
+        ASSERT_EQ(foo.get<BarA>(it).value, static_cast<int>(index));
+        ASSERT_EQ(foo.get<BarB>(it).value, static_cast<float>(index) * 2.0f);
+    }
+}
+
+TEST(System, Group)
+{
+    ECS::Executor executor;
+    executor.addPipeline<DummyPipeline>(60);
+    auto &foo = executor.addSystem<BarSystem>();
+    auto group = foo.group<BarA, BarB>();
+
+    // Grouped & ungrouped entities
+    const auto entityA = foo.add(BarA { 1 });
+    const auto entityB = foo.add(BarA { 2 }, BarB { 3.0f });
+    group.onAdd(entityB);
+    const auto entityC = foo.add(BarA { 4 }, BarB { 5.0f });
+    group.onAdd(entityC);
+
+    ASSERT_EQ(group.count(), 2u);
+    ASSERT_FALSE(group.contains(entityA));
+    ASSERT_TRUE(group.contains(entityB));
+    ASSERT_TRUE(group.contains(entityC));
+
+    // Grouped entities are packed at the front of both tables
+    ASSERT_LT(foo.getTable<BarA>().getUnstableIndex(entityB), 2u);
+    ASSERT_LT(foo.getTable<BarA>().getUnstableIndex(entityC), 2u);
+    ASSERT_LT(foo.getTable<BarB>().getUnstableIndex(entityB), 2u);
+
+    // Traverse the group
+    std::size_t visited {};
+    group.traverse([&visited](const ECS::Entity entity, BarA &barA, BarB &barB) {
+        ASSERT_NE(entity, entityA);
+        ASSERT_EQ(static_cast<float>(barA.value) + 1.0f, barB.value);
+        ++visited;
+    });
+    ASSERT_EQ(visited, 2u);
+
+    // Remove an entity from the group before detaching its components
+    group.onRemove(entityB);
+    foo.dettach<BarB>(entityB);
+    ASSERT_EQ(group.count(), 1u);
+    ASSERT_FALSE(group.contains(entityB));
+    ASSERT_TRUE(group.contains(entityC));
+    ASSERT_EQ(foo.getTable<BarA>().getUnstableIndex(entityC), 0u);
+}
+
+TEST(System, CommandBuffer)
+{
+    ECS::Executor executor;
+    executor.addPipeline<DummyPipeline>(60);
+    auto &foo = executor.addSystem<BarSystem>();
+    ECS::CommandBuffer<BarSystem> commands(2u);
+
+    const auto range = foo.addRange(4u, BarA { 1 });
+    const auto entity = foo.add(BarA { 2 }, BarB { 3.0f });
+
+    // Record commands from two workers
+    commands.attach(0u, range.begin, BarB { 4.0f });
+    commands.attach(1u, range.begin + 1u, BarB { 5.0f });
+    commands.detach<BarB>(0u, entity);
+    for (auto it = range.begin; it != range.end; ++it)
+        commands.remove(1u, it);
+
+    // Nothing is applied until replay
+    ASSERT_FALSE(foo.getTable<BarB>().exists(range.begin));
+    ASSERT_TRUE(foo.getTable<BarB>().exists(entity));
+
+    // Replay all commands at once
+    commands.apply(foo);
+    ASSERT_FALSE(foo.getTable<BarA>().exists(range.begin));
+    ASSERT_FALSE(foo.getTable<BarB>().exists(range.begin));
+    ASSERT_TRUE(foo.getTable<BarA>().exists(entity));
+    ASSERT_FALSE(foo.getTable<BarB>().exists(entity));
+    ASSERT_EQ(foo.get<BarA>(entity).value, 2);
+
+    // Removed entities are free for reuse
+    const auto range2 = foo.addRange(4u, BarA { 6 });
+    ASSERT_EQ(range2, range);
+
+    // Attaches of every worker replay before any detach, regardless of worker index
+    const auto entity2 = foo.add(BarA { 7 });
+    commands.attach(1u, entity2, BarB { 8.0f });
+    commands.detach<BarB>(0u, entity2);
+    commands.apply(foo);
+    ASSERT_TRUE(foo.getTable<BarA>().exists(entity2));
+    ASSERT_FALSE(foo.getTable<BarB>().exists(entity2));
+}
+
+class ChainedA : public ECS::System<"ChainedA", DummyPipeline>
+{
+public:
+    static inline std::size_t ticks {};
+    [[nodiscard]] bool tick(void) noexcept override { ++ticks; return false; }
+};
+class ChainedB : public ECS::System<"ChainedB", DummyPipeline>
+{
+public:
+    static inline std::size_t ticks {};
+    [[nodiscard]] bool tick(void) noexcept override { ++ticks; return false; }
+};
+
+TEST(System, StaticSystemChain)
+{
+    ECS::Executor executor;
+    executor.addPipeline<DummyPipeline>(60);
+    auto &chain = executor.addSystem<ECS::StaticSystemChain<"Chained", ChainedA, ChainedB>>();
+
+    // Children are bound to the executor and reachable by type
+    ASSERT_EQ(&chain.get<ChainedA>().parent(), &executor);
+    ASSERT_EQ(chain.get<ChainedB>().systemName(), "ChainedB");
+
+    // One composite tick runs every child tick in order
+    ChainedA::ticks = 0u;
+    ChainedB::ticks = 0u;
+    ASSERT_FALSE(chain.tick());
+    ASSERT_EQ(ChainedA::ticks, 1u);
+    ASSERT_EQ(ChainedB::ticks, 1u);
+
+    // Entities of the chain children are independent
+    const auto entity = chain.get<ChainedA>().add();
+    ASSERT_EQ(entity, 1u);
+}
+
 class StableSystem : public ECS::System<
     "Bar", DummyPipeline, Core::DefaultStaticAllocator,
     ECS::StableComponent<BarB>
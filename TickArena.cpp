@@ -0,0 +1,33 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tick arena
+ */
+
+#include <Kube/Core/Abort.hpp>
+
+#include "TickArena.hpp"
+
+using namespace kF;
+
+ECS::TickArena::TickArena(const std::size_t capacity) noexcept
+{
+    kFEnsure(capacity != 0,
+        "ECS::TickArena: Arena capacity cannot be null");
+    _buffer.insertCustom(_buffer.end(), capacity, [](const auto, const auto) {});
+}
+
+void *ECS::TickArena::allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    // Align the absolute address: the byte buffer itself carries no alignment guarantee
+    const auto base = reinterpret_cast<std::uintptr_t>(_buffer.data());
+    auto head = _head.load(std::memory_order_relaxed);
+
+    while (true) {
+        const auto aligned = ((base + head + alignment - 1u) & ~(static_cast<std::uintptr_t>(alignment) - 1u)) - base;
+        const auto next = aligned + bytes;
+        kFEnsure(next <= _buffer.size(),
+            "ECS::TickArena::allocate: Arena capacity '", _buffer.size(), "' exceeded, allocation of '", bytes, "' bytes failed");
+        if (_head.compare_exchange_weak(head, next, std::memory_order_relaxed)) [[likely]]
+            return _buffer.data() + aligned;
+    }
+}
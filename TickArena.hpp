@@ -0,0 +1,61 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tick arena
+ */
+
+#pragma once
+
+#include <atomic>
+#include <span>
+
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    class TickArena;
+}
+
+/** @brief Linear scratch allocator scoped to a pipeline tick
+ *  @note Allocation is a single atomic bump so parallel tasks allocate without locks, and the whole
+ *  arena is recycled by 'reset' at the pipeline begin task. Returned memory is uninitialized and
+ *  must not outlive the tick. The arena never grows: exceeding its capacity aborts, size it for the
+ *  worst tick */
+class alignas_double_cacheline kF::ECS::TickArena
+{
+public:
+    /** @brief Destructor */
+    ~TickArena(void) noexcept = default;
+
+    /** @brief Capacity constructor */
+    TickArena(const std::size_t capacity) noexcept;
+
+    /** @brief TickArena is not copiable */
+    TickArena(const TickArena &other) noexcept = delete;
+    TickArena &operator=(const TickArena &other) noexcept = delete;
+
+
+    /** @brief Allocate an uninitialized span of scratch objects */
+    template<typename Type>
+    [[nodiscard]] inline std::span<Type> allocate(const std::size_t count) noexcept
+        { return std::span<Type>(reinterpret_cast<Type *>(allocate(count * sizeof(Type), alignof(Type))), count); }
+
+    /** @brief Allocate uninitialized scratch bytes */
+    [[nodiscard]] void *allocate(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+
+    /** @brief Recycle the whole arena, must not race any allocation */
+    inline void reset(void) noexcept { _head.store(0u, std::memory_order_relaxed); }
+
+
+    /** @brief Get arena capacity in bytes */
+    [[nodiscard]] inline std::size_t capacity(void) const noexcept { return _buffer.size(); }
+
+    /** @brief Get allocated bytes since the last reset, including alignment padding */
+    [[nodiscard]] inline std::size_t used(void) const noexcept { return _head.load(std::memory_order_relaxed); }
+
+private:
+    Core::Vector<std::byte, ECSAllocator> _buffer {};
+    std::atomic<std::size_t> _head { 0u };
+};